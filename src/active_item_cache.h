@@ -3,6 +3,7 @@
 #define ACTIVE_ITEM_CACHE_H
 
 #include "enums.h"
+#include "turn_arena.h"
 
 #include <list>
 #include <unordered_map>
@@ -32,7 +33,8 @@ class active_item_cache
         // Use this one if there's a chance that the item being referenced has been invalidated.
         bool has( item_reference const &itm ) const;
         bool empty() const;
-        std::list<item_reference> get();
+        /** The returned list is allocated from the turn arena. */
+        turn_vector<item_reference> get();
 
         /** Subtract delta from every item_reference's location */
         void subtract_locations( const point &delta );
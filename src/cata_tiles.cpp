@@ -38,6 +38,7 @@
 
 #include <cassert>
 #include <algorithm>
+#include <functional>
 #include <fstream>
 #include <stdlib.h>     /* srand, rand */
 #include <sstream>
@@ -246,6 +247,7 @@ void cata_tiles::load_tileset( const std::string &tileset_id, const bool prechec
     tileset_loader loader( *new_tileset_ptr, renderer );
     loader.load( tileset_id, precheck );
     tileset_ptr = std::move( new_tileset_ptr );
+    clear_tile_lookups();
 
     set_draw_scale(16);
 }
@@ -1030,6 +1032,9 @@ void cata_tiles::draw( int destx, int desty, const tripoint &center, int width,
     auto vision_cache = g->u.get_vision_modes();
     nv_goggles_activated = vision_cache[NV_GOGGLES];
 
+    // Sprites of each pass over a row are collected and submitted together, see render_sprite.
+    // Isometric tiles overlap their neighbours, so they are drawn straight away.
+    queue_sprites = !iso_mode;
     for( int row = min_row; row < max_row; row ++) {
         std::vector<tile_render_info> draw_points;
         draw_points.reserve(max_col);
@@ -1078,6 +1083,7 @@ void cata_tiles::draw( int destx, int desty, const tripoint &center, int width,
 
             draw_points.push_back( tile_render_info( tripoint( x, y, center.z ), height_3d ) );
         }
+        flush_sprite_queue();
         const std::array<decltype ( &cata_tiles::draw_furniture ), 7> drawing_layers = {{
             &cata_tiles::draw_furniture, &cata_tiles::draw_trap,
             &cata_tiles::draw_field_or_item, &cata_tiles::draw_vpart,
@@ -1090,8 +1096,10 @@ void cata_tiles::draw( int destx, int desty, const tripoint &center, int width,
             for( auto &p : draw_points ) {
                 (this->*f)( p.pos, ch.visibility_cache[p.pos.x][p.pos.y], p.height_3d );
             }
+            flush_sprite_queue();
         }
     }
+    queue_sprites = false;
 
     in_animation = do_draw_explosion || do_draw_custom_explosion ||
                    do_draw_bullet || do_draw_hit || do_draw_line ||
@@ -1535,15 +1543,15 @@ void cata_tiles::get_window_tile_counts(const int width, const int height, int &
     rows = tile_iso ? ceil((double) height / ( tile_width / 2 - 1 ) ) * 2 + 4 : ceil((double) height / tile_height);
 }
 
-bool cata_tiles::draw_from_id_string( std::string id, tripoint pos, int subtile, int rota,
+bool cata_tiles::draw_from_id_string( const std::string &id, tripoint pos, int subtile, int rota,
                                       lit_level ll, bool apply_night_vision_goggles )
 {
     int nullint = 0;
-    return cata_tiles::draw_from_id_string( std::move( id ), C_NONE, empty_string, pos, subtile, rota,
+    return cata_tiles::draw_from_id_string( id, C_NONE, empty_string, pos, subtile, rota,
                                             ll, apply_night_vision_goggles, nullint );
 }
 
-bool cata_tiles::draw_from_id_string( std::string id, TILE_CATEGORY category,
+bool cata_tiles::draw_from_id_string( const std::string &id, TILE_CATEGORY category,
                                       const std::string &subcategory, tripoint pos,
                                       int subtile, int rota, lit_level ll,
                                       bool apply_night_vision_goggles )
@@ -1553,10 +1561,10 @@ bool cata_tiles::draw_from_id_string( std::string id, TILE_CATEGORY category,
                                             ll, apply_night_vision_goggles, nullint );
 }
 
-bool cata_tiles::draw_from_id_string( std::string id, tripoint pos, int subtile, int rota,
+bool cata_tiles::draw_from_id_string( const std::string &id, tripoint pos, int subtile, int rota,
                                       lit_level ll, bool apply_night_vision_goggles, int &height_3d )
 {
-    return cata_tiles::draw_from_id_string( std::move( id ), C_NONE, empty_string, pos, subtile, rota,
+    return cata_tiles::draw_from_id_string( id, C_NONE, empty_string, pos, subtile, rota,
                                             ll, apply_night_vision_goggles, height_3d );
 }
 
@@ -1632,10 +1640,88 @@ const tile_type *cata_tiles::find_tile_looks_like( std::string &id, TILE_CATEGOR
 }
 
 
-bool cata_tiles::draw_from_id_string( std::string id, TILE_CATEGORY category,
+void cata_tiles::clear_tile_lookups()
+{
+    for( auto &lookups : tile_lookups ) {
+        lookups.clear();
+    }
+    ter_lookups.clear();
+    furn_lookups.clear();
+}
+
+void cata_tiles::validate_tile_lookups()
+{
+    const int season = season_of_year( calendar::turn );
+    if( season != tile_lookups_season ) {
+        clear_tile_lookups();
+        tile_lookups_season = season;
+    }
+}
+
+const cata_tiles::tile_lookup &cata_tiles::find_tile_cached( const std::string &id,
+        const TILE_CATEGORY category )
+{
+    validate_tile_lookups();
+    auto &lookups = tile_lookups[category];
+    const auto iter = lookups.find( id );
+    if( iter != lookups.end() ) {
+        return iter->second;
+    }
+    // References to the elements stay valid, even while the subtiles below are inserted.
+    tile_lookup &result = lookups[id];
+    result.found_id = id;
+    result.tt = find_tile_looks_like( result.found_id, category );
+    if( result.tt && result.tt->multitile ) {
+        const auto &available = result.tt->available_subtiles;
+        for( size_t i = 0; i < multitile_keys.size(); ++i ) {
+            if( std::find( available.begin(), available.end(), multitile_keys[i] ) != available.end() ) {
+                // Subtiles are looked up without a category, just like the id they are named by.
+                result.subtiles[i] = &find_tile_cached( result.found_id + "_" + multitile_keys[i], C_NONE );
+            }
+        }
+    }
+    return result;
+}
+
+const cata_tiles::tile_lookup &cata_tiles::find_tile_cached( const ter_id &t )
+{
+    validate_tile_lookups();
+    const size_t i = t.to_i();
+    if( i >= ter_lookups.size() ) {
+        ter_lookups.resize( i + 1, nullptr );
+    }
+    if( ter_lookups[i] == nullptr ) {
+        ter_lookups[i] = &find_tile_cached( t.obj().id.str(), C_TERRAIN );
+    }
+    return *ter_lookups[i];
+}
+
+const cata_tiles::tile_lookup &cata_tiles::find_tile_cached( const furn_id &f )
+{
+    validate_tile_lookups();
+    const size_t i = f.to_i();
+    if( i >= furn_lookups.size() ) {
+        furn_lookups.resize( i + 1, nullptr );
+    }
+    if( furn_lookups[i] == nullptr ) {
+        furn_lookups[i] = &find_tile_cached( f.obj().id.str(), C_FURNITURE );
+    }
+    return *furn_lookups[i];
+}
+
+bool cata_tiles::draw_from_id_string( const std::string &id, TILE_CATEGORY category,
                                       const std::string &subcategory, tripoint pos,
                                       int subtile, int rota, lit_level ll,
                                       bool apply_night_vision_goggles, int &height_3d )
+{
+    return draw_from_lookup( find_tile_cached( id, category ), category, subcategory, pos, subtile,
+                             rota, ll, apply_night_vision_goggles, height_3d );
+}
+
+bool cata_tiles::draw_from_lookup( const tile_lookup &lookup, TILE_CATEGORY category,
+                                   const std::string &subcategory, tripoint pos,
+                                   int subtile, int rota, lit_level ll,
+                                   bool apply_night_vision_goggles, int &height_3d )
 {
     // If the ID string does not produce a drawable tile
     // it will revert to the "unknown" tile.
@@ -1650,7 +1736,8 @@ bool cata_tiles::draw_from_id_string( std::string id, TILE_CATEGORY category,
         return false;
     }
 
-    const tile_type *tt = find_tile_looks_like( id, category );
+    const std::string &id = lookup.found_id;
+    const tile_type *tt = lookup.tt;
 
     if( !tt ) {
         uint32_t sym = UNKNOWN_UNICODE;
@@ -1772,13 +1859,10 @@ bool cata_tiles::draw_from_id_string( std::string id, TILE_CATEGORY category,
     const tile_type &display_tile = *tt;
     // check to see if the display_tile is multitile, and if so if it has the key related to subtile
     if (subtile != -1 && display_tile.multitile) {
-        auto const &display_subtiles = display_tile.available_subtiles;
-        auto const end = std::end(display_subtiles);
-        if (std::find(begin(display_subtiles), end, multitile_keys[subtile]) != end) {
-            // append subtile name to tile and re-find display_tile
-            return draw_from_id_string(
-                std::move( id.append( "_", 1 ).append( multitile_keys[subtile] ) ),
-                pos, -1, rota, ll, apply_night_vision_goggles, height_3d );
+        if( lookup.tt == tt && lookup.subtiles[subtile] != nullptr ) {
+            // draw the pre-resolved tile named by the subtile appended to the id
+            return draw_from_lookup( *lookup.subtiles[subtile], C_NONE, empty_string,
+                                     pos, -1, rota, ll, apply_night_vision_goggles, height_3d );
         }
     }
 
@@ -1886,7 +1970,6 @@ bool cata_tiles::draw_sprite_at( const tile_type &tile, const weighted_int_list<
         return true;
     }
 
-    int ret = 0;
     // blit foreground based on rotation
     bool rotate_sprite = false;
     int sprite_num = 0;
@@ -1937,36 +2020,31 @@ bool cata_tiles::draw_sprite_at( const tile_type &tile, const weighted_int_list<
     destination.w = width * tile_width / tileset_ptr->get_tile_width();
     destination.h = height * tile_height / tileset_ptr->get_tile_height();
 
+    double angle = 0;
+    SDL_RendererFlip flip = SDL_FLIP_NONE;
     if ( rotate_sprite ) {
         switch ( rota ) {
             default:
             case 0: // unrotated (and 180, with just two sprites)
-                ret = sprite_tex->render_copy_ex( renderer, &destination,
-                    0, NULL, SDL_FLIP_NONE );
                 break;
             case 1: // 90 degrees (and 270, with just two sprites)
 #if (defined _WIN32 || defined WINDOWS)
                 destination.y -= 1;
 #endif
-                ret = sprite_tex->render_copy_ex( renderer, &destination,
-                    -90, NULL, SDL_FLIP_NONE );
+                angle = -90;
                 break;
             case 2: // 180 degrees, implemented with flips instead of rotation
-                ret = sprite_tex->render_copy_ex( renderer, &destination,
-                    0, NULL, static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL ) );
+                flip = static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL );
                 break;
             case 3: // 270 degrees
 #if (defined _WIN32 || defined WINDOWS)
                 destination.x -= 1;
 #endif
-                ret = sprite_tex->render_copy_ex( renderer, &destination,
-                    90, NULL, SDL_FLIP_NONE );
+                angle = 90;
                 break;
         }
-    } else { // don't rotate, same as case 0 above
-        ret = sprite_tex->render_copy_ex( renderer, &destination,
-            0, NULL, SDL_FLIP_NONE );
     }
+    const int ret = render_sprite( *sprite_tex, destination, angle, flip, x, y );
 
     printErrorIf( ret != 0, "SDL_RenderCopyEx() failed" );
     // this reference passes all the way back up the call chain back to
@@ -1976,6 +2054,58 @@ bool cata_tiles::draw_sprite_at( const tile_type &tile, const weighted_int_list<
     return true;
 }
 
+int cata_tiles::render_sprite( const texture &tex, const SDL_Rect &destination, const double angle,
+                               const SDL_RendererFlip flip, const int x, const int y )
+{
+    if( !queue_sprites ) {
+        return tex.render_copy_ex( renderer, &destination, angle, NULL, flip );
+    }
+    queued_sprite sprite{ &tex, destination, angle, flip, 0 };
+    const point cell( x, y );
+    if( !sprite_queue.empty() ) {
+        if( cell == sprite_queue_cell ) {
+            // stacked on the previous sprite (bg/fg, field/item, ...)
+            sprite.depth = sprite_queue.back().depth + 1;
+        } else if( cell.y != sprite_queue_cell.y || cell.x < sprite_queue_cell.x ) {
+            // the tile was not drawn in one go, its stacking order is unknown
+            sprite_queue_sortable = false;
+        }
+    }
+    if( destination.x < x || destination.y < y ||
+        destination.x + destination.w > x + tile_width || destination.y + destination.h > y + tile_height ) {
+        // reaches into the neighbouring tiles, so it must stay in painter's order
+        sprite_queue_sortable = false;
+    }
+    sprite_queue_cell = cell;
+    sprite_queue.push_back( sprite );
+    return 0;
+}
+
+void cata_tiles::flush_sprite_queue()
+{
+    if( sprite_queue.empty() ) {
+        return;
+    }
+    if( sprite_queue_sortable ) {
+        // All sprites stay within their own tile, so only the stacking inside a tile matters.
+        // Group the rest by texture so the renderer can batch consecutive copies.
+        std::stable_sort( sprite_queue.begin(), sprite_queue.end(),
+        []( const queued_sprite & lhs, const queued_sprite & rhs ) {
+            if( lhs.depth != rhs.depth ) {
+                return lhs.depth < rhs.depth;
+            }
+            return std::less<const SDL_Texture *>()( lhs.tex->sdl_texture(), rhs.tex->sdl_texture() );
+        } );
+    }
+    for( const auto &sprite : sprite_queue ) {
+        const int ret = sprite.tex->render_copy_ex( renderer, &sprite.destination, sprite.angle, NULL,
+                        sprite.flip );
+        printErrorIf( ret != 0, "SDL_RenderCopyEx() failed" );
+    }
+    sprite_queue.clear();
+    sprite_queue_sortable = true;
+}
+
 bool cata_tiles::draw_tile_at( const tile_type &tile, int x, int y, unsigned int loc_rand, int rota,
                                lit_level ll, bool apply_night_vision_goggles, int &height_3d )
 {
@@ -2101,10 +2231,8 @@ bool cata_tiles::draw_terrain( const tripoint &p, lit_level ll, int &height_3d )
         // do something to get other terrain orientation values
     }
 
-    const std::string& tname = t.obj().id.str();
-
-    return draw_from_id_string( tname, C_TERRAIN, empty_string, p, subtile, rotation, ll,
-                                nv_goggles_activated, height_3d );
+    return draw_from_lookup( find_tile_cached( t ), C_TERRAIN, empty_string, p, subtile, rotation, ll,
+                             nv_goggles_activated, height_3d );
 }
 
 bool cata_tiles::draw_furniture( const tripoint &p, lit_level ll, int &height_3d )
@@ -2129,10 +2257,8 @@ bool cata_tiles::draw_furniture( const tripoint &p, lit_level ll, int &height_3d
     int rotation = 0;
     get_tile_values(f_id, neighborhood, subtile, rotation);
 
-    // get the name of this furniture piece
-    const std::string& f_name = f_id.obj().id.str();
-    bool ret = draw_from_id_string( f_name, C_FURNITURE, empty_string, p, subtile, rotation, ll,
-                                    nv_goggles_activated, height_3d );
+    bool ret = draw_from_lookup( find_tile_cached( f_id ), C_FURNITURE, empty_string, p, subtile,
+                                 rotation, ll, nv_goggles_activated, height_3d );
     if( ret && g->m.sees_some_items( p, g->u ) ) {
         draw_item_highlight( p );
     }
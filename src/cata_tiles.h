@@ -12,7 +12,9 @@
 #include "weather.h"
 #include "enums.h"
 #include "weighted_list.h"
+#include "int_id.h"
 
+#include <array>
 #include <memory>
 #include <list>
 #include <map>
@@ -25,6 +27,10 @@ class Creature;
 class player;
 class JsonObject;
 struct visibility_variables;
+struct ter_t;
+using ter_id = int_id<ter_t>;
+struct furn_t;
+using furn_id = int_id<furn_t>;
 
 extern void set_displaybuffer_rendertarget();
 
@@ -97,6 +103,10 @@ class texture
                             const SDL_Point *const center, const SDL_RendererFlip flip ) const {
             return SDL_RenderCopyEx( renderer, sdl_texture_ptr.get(), &srcrect, dstrect, angle, center, flip );
         }
+        /// The atlas this sprite is cut from, shared by many textures.
+        const SDL_Texture *sdl_texture() const {
+            return sdl_texture_ptr.get();
+        }
 };
 
 struct SDL_Surface_deleter {
@@ -405,16 +415,40 @@ class cata_tiles
         const tile_type *find_tile_with_season( std::string &id );
         const tile_type *find_tile_looks_like( std::string &id, TILE_CATEGORY category );
 
-        bool draw_from_id_string( std::string id, tripoint pos, int subtile, int rota, lit_level ll,
+        /** Result of a tile lookup, with season and looks_like already applied. */
+        struct tile_lookup {
+            /** Id of the found tile. The requested id if no tile was found. */
+            std::string found_id;
+            /** nullptr if no tile was found. */
+            const tile_type *tt = nullptr;
+            /** For multitiles, the lookup of each available @ref MULTITILE_TYPE variant. */
+            std::array<const tile_lookup *, num_multitile_types> subtiles = {{}};
+        };
+        /**
+         * Memoised @ref find_tile_looks_like. Results are kept until the season changes or
+         * another tileset is loaded.
+         */
+        const tile_lookup &find_tile_cached( const std::string &id, TILE_CATEGORY category );
+        /** Same as above, but indexed by the id itself, so no strings are involved. */
+        const tile_lookup &find_tile_cached( const ter_id &t );
+        const tile_lookup &find_tile_cached( const furn_id &f );
+        /** Clears all cached lookups if they were made for another season. */
+        void validate_tile_lookups();
+        void clear_tile_lookups();
+
+        bool draw_from_id_string( const std::string &id, tripoint pos, int subtile, int rota, lit_level ll,
                                   bool apply_night_vision_goggles );
-        bool draw_from_id_string( std::string id, TILE_CATEGORY category,
+        bool draw_from_id_string( const std::string &id, TILE_CATEGORY category,
                                   const std::string &subcategory, tripoint pos, int subtile, int rota,
                                   lit_level ll, bool apply_night_vision_goggles );
-        bool draw_from_id_string( std::string id, tripoint pos, int subtile, int rota, lit_level ll,
+        bool draw_from_id_string( const std::string &id, tripoint pos, int subtile, int rota, lit_level ll,
                                   bool apply_night_vision_goggles, int &height_3d );
-        bool draw_from_id_string( std::string id, TILE_CATEGORY category,
+        bool draw_from_id_string( const std::string &id, TILE_CATEGORY category,
                                   const std::string &subcategory, tripoint pos, int subtile, int rota,
                                   lit_level ll, bool apply_night_vision_goggles, int &height_3d );
+        bool draw_from_lookup( const tile_lookup &lookup, TILE_CATEGORY category,
+                               const std::string &subcategory, tripoint pos, int subtile, int rota,
+                               lit_level ll, bool apply_night_vision_goggles, int &height_3d );
         bool draw_sprite_at( const tile_type &tile, const weighted_int_list<std::vector<int>> &svlist,
                              int x, int y, unsigned int loc_rand, bool rota_fg, int rota, lit_level ll,
                              bool apply_night_vision_goggles );
@@ -423,6 +457,18 @@ class cata_tiles
                              bool apply_night_vision_goggles, int &height_3d );
         bool draw_tile_at( const tile_type &tile, int x, int y, unsigned int loc_rand, int rota,
                            lit_level ll, bool apply_night_vision_goggles, int &height_3d );
+        /**
+         * Renders a sprite of the tile at screen position (x, y), or queues it while the map
+         * is drawn. Queued sprites are submitted by @ref flush_sprite_queue.
+         */
+        int render_sprite( const texture &tex, const SDL_Rect &destination, double angle,
+                           SDL_RendererFlip flip, int x, int y );
+        /**
+         * Submits the queued sprites grouped by atlas texture, so the renderer can batch them.
+         * Sprites stacked on one tile keep their order, and if any sprite reaches outside its
+         * tile the whole queue is drawn in the order it was submitted.
+         */
+        void flush_sprite_queue();
 
         ///@throws std::exception upon errors.
         ///@returns Always a valid pointer.
@@ -613,6 +659,26 @@ class cata_tiles
         void prepare_minimap_cache_for_updates();
         void clear_unused_minimap_cache();
 
+        // Cached tile lookups, see find_tile_cached
+        std::array<std::unordered_map<std::string, tile_lookup>, C_WEATHER + 1> tile_lookups;
+        std::vector<const tile_lookup *> ter_lookups;
+        std::vector<const tile_lookup *> furn_lookups;
+        int tile_lookups_season = -1;
+
+        // Sprites of the current pass over a map row, see render_sprite
+        struct queued_sprite {
+            const texture *tex;
+            SDL_Rect destination;
+            double angle;
+            SDL_RendererFlip flip;
+            /** Number of sprites drawn below it on the same tile. */
+            int depth;
+        };
+        std::vector<queued_sprite> sprite_queue;
+        bool queue_sprites = false;
+        bool sprite_queue_sortable = true;
+        point sprite_queue_cell;
+
         //the minimap texture pool which is used to reduce new texture allocation spam
         minimap_shared_texture_pool tex_pool;
         std::map<tripoint, minimap_submap_cache> minimap_cache;
@@ -5,6 +5,7 @@
 #include "map_selector.h"
 #include "effect.h"
 #include "vehicle_selector.h"
+#include "visitable_inline.h"
 #include "debug.h"
 #include "mission.h"
 #include "translations.h"
@@ -671,7 +672,7 @@ std::vector<item_location> Character::nearby( const std::function<bool(const ite
 {
     std::vector<item_location> res;
 
-    visit_items( [&]( const item *e, const item *parent ) {
+    visit_items_inline( [&]( const item *e, const item *parent ) {
         if( func( e, parent ) ) {
             res.emplace_back( const_cast<Character &>( *this ), const_cast<item *>( e ) );
         }
@@ -679,7 +680,7 @@ std::vector<item_location> Character::nearby( const std::function<bool(const ite
     } );
 
     for( const auto &cur : map_selector( pos(), radius ) ) {
-        cur.visit_items( [&]( const item *e, const item *parent  ) {
+        cur.visit_items_inline( [&]( const item *e, const item *parent  ) {
             if( func( e, parent ) ) {
                 res.emplace_back( cur, const_cast<item *>( e ) );
             }
@@ -688,7 +689,7 @@ std::vector<item_location> Character::nearby( const std::function<bool(const ite
     }
 
     for( const auto &cur : vehicle_selector( pos(), radius ) ) {
-        cur.visit_items( [&]( const item *e, const item *parent  ) {
+        cur.visit_items_inline( [&]( const item *e, const item *parent  ) {
             if( func( e, parent ) ) {
                 res.emplace_back( cur, const_cast<item *>( e ) );
             }
@@ -723,7 +724,7 @@ long int Character::i_add_to_container(const item &it, const bool unloading)
         return charges;
     };
 
-    visit_items( [ & ]( item *item ) {
+    visit_items_inline( [ & ]( item *item, ::item * ) {
         if( charges > 0 && item->is_ammo_container() && item_type == item->contents.front().typeId() ) {
             charges = add_to_container(*item);
         }
@@ -1178,9 +1179,21 @@ bool Character::is_wearing_on_bp(const itype_id & it, body_part bp) const
 
 bool Character::worn_with_flag( const std::string &flag, body_part bp ) const
 {
-    return std::any_of( worn.begin(), worn.end(), [&flag, bp]( const item &it ) {
-        return it.has_flag( flag ) && ( bp == num_bp || it.covers( bp ) );
-    } );
+    get_worn_summary();
+    auto &flags = worn_summary_cache.flags;
+    auto iter = flags.find( flag );
+    if( iter == flags.end() ) {
+        worn_summary::flag_coverage coverage{ false, body_part_set() };
+        const interned_flag f( flag );
+        for( const item &it : worn ) {
+            if( it.has_flag( f ) ) {
+                coverage.any = true;
+                coverage.parts |= it.get_covered_body_parts();
+            }
+        }
+        iter = flags.emplace( flag, coverage ).first;
+    }
+    return bp == num_bp ? iter->second.any : iter->second.parts.test( bp );
 }
 
 SkillLevel &Character::get_skill_level_object( const skill_id &ident )
@@ -1442,6 +1455,55 @@ bool Character::has_nv()
 void Character::reset_encumbrance()
 {
     encumbrance_cache = calc_encumbrance();
+    worn_summary_dirty = true;
+}
+
+const Character::worn_summary &Character::get_worn_summary() const
+{
+    if( !worn_summary_dirty && worn_summary_size == worn.size() ) {
+        return worn_summary_cache;
+    }
+    static const material_id wool( "wool" );
+    static const interned_flag helmet_compat( "HELMET_COMPAT" );
+    static const interned_flag skintight( "SKINTIGHT" );
+    static const interned_flag oversize( "OVERSIZE" );
+    static const interned_flag belted( "BELTED" );
+
+    worn_summary &summary = worn_summary_cache;
+    summary = worn_summary();
+    summary.wool_warmth.fill( 0 );
+    for( const item &it : worn ) {
+        const body_part_set parts = it.get_covered_body_parts();
+        summary.covered |= parts;
+        if( parts.test( bp_head ) && !it.has_flag( helmet_compat ) && !it.has_flag( skintight ) &&
+            !it.has_flag( oversize ) ) {
+            summary.helmet = true;
+        }
+        if( !it.has_flag( belted ) && !it.has_flag( skintight ) ) {
+            summary.shoe_left = summary.shoe_left || parts.test( bp_foot_l );
+            summary.shoe_right = summary.shoe_right || parts.test( bp_foot_r );
+        }
+        if( it.is_power_armor() ) {
+            summary.power_armor = true;
+            summary.power_armor_helmet = summary.power_armor_helmet || parts.test( bp_head );
+        }
+        if( parts.any() ) {
+            const int warmth = it.get_warmth();
+            const bool is_wool = it.made_of( wool );
+            for( const body_part bp : all_body_parts ) {
+                if( !parts.test( bp ) ) {
+                    continue;
+                } else if( is_wool ) {
+                    summary.wool_warmth[bp] += warmth;
+                } else {
+                    summary.wettable_warmth[bp].push_back( warmth );
+                }
+            }
+        }
+    }
+    worn_summary_dirty = false;
+    worn_summary_size = worn.size();
+    return summary;
 }
 
 std::array<encumbrance_data, num_bp> Character::calc_encumbrance() const
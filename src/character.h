@@ -258,6 +258,10 @@ class Character : public Creature, public visitable<Character>
 
         /** Recalculates encumbrance cache. */
         void reset_encumbrance();
+        /** Called when worn items change, see @ref get_worn_summary. */
+        void set_worn_summary_dirty() {
+            worn_summary_dirty = true;
+        }
         /** Returns ENC provided by armor, etc. */
         int encumb( body_part bp ) const;
 
@@ -725,6 +729,39 @@ class Character : public Creature, public visitable<Character>
 
         std::array<encumbrance_data, num_bp> encumbrance_cache;
 
+        /** What the worn items add up to, see @ref get_worn_summary. */
+        struct worn_summary {
+            /** Body parts covered by anything. */
+            body_part_set covered;
+            /** Something on the head that is not HELMET_COMPAT, SKINTIGHT or OVERSIZE. */
+            bool helmet = false;
+            /** Something on the foot that is neither BELTED nor SKINTIGHT. */
+            bool shoe_left = false;
+            bool shoe_right = false;
+            bool power_armor = false;
+            bool power_armor_helmet = false;
+            /** Warmth of wool items, which keep it when wet. */
+            std::array<int, num_bp> wool_warmth;
+            /** Warmth of the other items, one entry per item as each is reduced by wetness separately. */
+            std::array<std::vector<int>, num_bp> wettable_warmth;
+            /** Body parts covered by items with a flag, filled in by @ref worn_with_flag as flags are asked for. */
+            struct flag_coverage {
+                bool any;
+                body_part_set parts;
+            };
+            std::unordered_map<std::string, flag_coverage> flags;
+        };
+        /**
+         * Summary of @ref worn, built on first use after items were put on or taken off
+         * (item::on_wear and item::on_takeoff), switched on or off, tailored or
+         * @ref reset_encumbrance was called.
+         */
+        const worn_summary &get_worn_summary() const;
+        mutable worn_summary worn_summary_cache;
+        mutable bool worn_summary_dirty = true;
+        // Catches items added or removed without the hooks above
+        mutable size_t worn_summary_size = 0;
+
         /**
          * Traits / mutations of the character. Key is the mutation id (it's also a valid
          * key into @ref mutation_data), the value describes the status of the mutation.
@@ -358,6 +358,12 @@ void player::invalidate_crafting_inventory()
     cached_time = calendar::before_time_starts;
 }
 
+recipe_availability &player::get_recipe_availability()
+{
+    recipe_avail->update( *this, crafting_inventory() );
+    return *recipe_avail;
+}
+
 void player::make_craft( const recipe_id &id_to_make, int batch_size )
 {
     make_craft_with_command( id_to_make, batch_size );
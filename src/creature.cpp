@@ -17,6 +17,7 @@
 #include "field.h"
 #include "projectile.h"
 #include "anatomy.h"
+#include "turn_arena.h"
 
 #include <algorithm>
 #include <numeric>
@@ -900,18 +901,19 @@ bool Creature::remove_effect( const efftype_id &eff_id, body_part bp )
     }
 
     // num_bp means remove all of a given effect id
+    const auto found = effects->find( eff_id );
     if (bp == num_bp) {
-        for( auto &it : ( *effects )[eff_id] ) {
+        for( auto &it : found->second ) {
             on_effect_int_change( eff_id, 0, it.first );
         }
-        effects->erase(eff_id);
+        effects->erase( found );
     } else {
-        ( *effects )[eff_id].erase(bp);
-        on_effect_int_change( eff_id, 0, bp );
+        found->second.erase(bp);
         // If there are no more effects of a given type remove the type map
-        if (( *effects )[eff_id].empty()) {
-            effects->erase(eff_id);
+        if( found->second.empty() ) {
+            effects->erase( found );
         }
+        on_effect_int_change( eff_id, 0, bp );
     }
     return true;
 }
@@ -968,24 +970,27 @@ int Creature::get_effect_int( const efftype_id &eff_id, body_part bp ) const
 }
 void Creature::process_effects()
 {
+    if( effects->empty() ) {
+        return;
+    }
     // id's and body_part's of all effects to be removed. If we ever get player or
     // monster specific removals these will need to be moved down to that level and then
     // passed in to this function.
-    std::vector<efftype_id> rem_ids;
-    std::vector<body_part> rem_bps;
+    turn_vector<std::pair<efftype_id, body_part>> removed;
 
     // Decay/removal of effects
     for( auto &elem : *effects ) {
         for( auto &_it : elem.second ) {
             // Add any effects that others remove to the removal list
             for( const auto& removed_effect : _it.second.get_removes_effects() ) {
-                rem_ids.push_back( removed_effect );
-                rem_bps.push_back(num_bp);
+                removed.emplace_back( removed_effect, num_bp );
             }
             effect &e = _it.second;
             const int prev_int = e.get_intensity();
             // Run decay effects, marking effects for removal as necessary.
-            e.decay( rem_ids, rem_bps, calendar::turn, is_player() );
+            if( e.decay( calendar::turn, is_player() ) ) {
+                removed.emplace_back( e.get_id(), e.get_bp() );
+            }
 
             if( e.get_intensity() != prev_int && e.get_duration() > 0_turns ) {
                 on_effect_int_change( e.get_id(), e.get_intensity(), e.get_bp() );
@@ -994,8 +999,8 @@ void Creature::process_effects()
     }
 
     // Actually remove effects. This should be the last thing done in process_effects().
-    for (size_t i = 0; i < rem_ids.size(); ++i) {
-        remove_effect( rem_ids[i], rem_bps[i] );
+    for( const auto &rem : removed ) {
+        remove_effect( rem.first, rem.second );
     }
 }
 
@@ -110,6 +110,16 @@ bool Creature_tracker::update_pos( const monster &critter, const tripoint &new_p
         }
     }
 
+    // A tracked monster is normally found at its current position, which avoids searching the
+    // whole list for every step of every monster.
+    const auto old_loc = monsters_by_location.find( critter.pos() );
+    if( old_loc != monsters_by_location.end() && old_loc->second.get() == &critter ) {
+        const std::shared_ptr<monster> critter_ptr = old_loc->second;
+        monsters_by_location.erase( old_loc );
+        monsters_by_location[new_pos] = critter_ptr;
+        return true;
+    }
+
     const auto iter = std::find_if( monsters_list.begin(), monsters_list.end(),
     [&]( const std::shared_ptr<monster> &ptr ) {
         return ptr.get() == &critter;
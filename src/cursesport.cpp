@@ -258,9 +258,11 @@ void catacurses::wredrawln( const window &/*win*/, int /*beg_line*/, int /*num_l
 
 // Get a sequence of Unicode code points, store them in target
 // return the display width of the extracted string.
-inline int fill(const char *&fmt, int &len, std::string &target)
+// Combining characters that don't fit into the cell are consumed but dropped.
+inline int fill(const char *&fmt, int &len, cata_cursesport::cell_text &target)
 {
     const char *const start = fmt;
+    const char *stored_end = fmt; // end of the bytes that fit into target
     int dlen = 0; // display width
     const char *tmpptr = fmt; // pointer for UTF8_getch, which increments it
     int tmplen = len;
@@ -285,11 +287,14 @@ inline int fill(const char *&fmt, int &len, std::string &target)
             // or by the next call to this function (replaced with a space).
             break;
         }
+        if( stored_end == fmt && static_cast<size_t>( tmpptr - start ) <= target.capacity ) {
+            stored_end = tmpptr;
+        }
         fmt = tmpptr;
         dlen += cw;
     }
-    target.assign(start, fmt - start);
-    len -= target.length();
+    target.assign(start, stored_end - start);
+    len -= fmt - start;
     return dlen;
 }
 
@@ -326,7 +331,7 @@ inline void printstring(cata_cursesport::WINDOW *win, const std::string &text)
     }
     if( win->cursorx > 0 && win->line[win->cursory].chars[win->cursorx].ch.empty() ) {
         // start inside a wide character, erase it for good
-        win->line[win->cursory].chars[win->cursorx - 1].ch.assign(" ");
+        win->line[win->cursory].chars[win->cursorx - 1].ch.assign( " ", 1 );
     }
     while( len > 0 ) {
         if( *fmt == '\n' ) {
@@ -353,7 +358,7 @@ inline void printstring(cata_cursesport::WINDOW *win, const std::string &text)
             // following cell ~> clear it
             cursecell *seccell = cur_cell( win );
             if (seccell && seccell->ch.empty()) {
-                seccell->ch.assign(' ', 1);
+                seccell->ch.assign( " ", 1 );
             }
         } else if( dlen == 2 ) {
             // the second cell, per definition must be empty
@@ -362,7 +367,7 @@ inline void printstring(cata_cursesport::WINDOW *win, const std::string &text)
                 // the previous cell was valid, this one is outside of the window
                 // --> the previous was the last cell of the last line
                 // --> there should not be a two-cell width character in the last cell
-                curcell->ch.assign(' ', 1);
+                curcell->ch.assign( " ", 1 );
                 return;
             }
             seccell->FG = win->FG;
@@ -376,7 +381,7 @@ inline void printstring(cata_cursesport::WINDOW *win, const std::string &text)
                 // So make that last cell a space, move the width
                 // character in the first cell of the line
                 seccell->ch = curcell->ch;
-                curcell->ch.assign(1, ' ');
+                curcell->ch.assign( " ", 1 );
                 // and make the second cell on the new line empty.
                 addedchar( win );
                 cursecell *thicell = cur_cell( win );
@@ -5,7 +5,8 @@
 #include <vector>
 #include <array>
 #include <string>
-#include <bitset>
+#include <cstdint>
+#include <cstring>
 
 
 class nc_color;
@@ -39,28 +40,114 @@ enum font_style_flag : int {
     FS_MAX,
 };
 
-class font_style : public std::bitset<FS_MAX>
+/** Set of @ref font_style_flag, packed into a single byte. */
+class font_style
 {
     public:
+        bool operator[]( const font_style_flag f ) const {
+            return ( bits >> f ) & 1;
+        }
+        void set( const font_style_flag f ) {
+            bits |= 1 << f;
+        }
+        void reset( const font_style_flag f ) {
+            bits &= ~( 1 << f );
+        }
+        unsigned long to_ulong() const {
+            return bits;
+        }
+        bool operator==( const font_style &fs ) const {
+            return bits == fs.bits;
+        }
+        bool operator!=( const font_style &fs ) const {
+            return bits != fs.bits;
+        }
         bool operator<( const font_style &fs ) const {
-            return to_ulong() < fs.to_ulong();
+            return bits < fs.bits;
+        }
+
+    private:
+        uint8_t bits = 0;
+};
+
+/**
+ * The UTF-8 text of a single cell: one character, possibly followed by combining
+ * characters. Stored inline and null-padded, so cells can be compared and copied as
+ * plain memory. Empty for the second cell of a wide character.
+ */
+class cell_text
+{
+    public:
+        /** Maximal number of bytes, excluding the terminating null. */
+        static constexpr size_t capacity = 10;
+
+        cell_text() {
+            std::memset( data, 0, sizeof( data ) );
         }
+        cell_text( const char *str ) : cell_text() {
+            assign( str, std::strlen( str ) );
+        }
+
+        /** Stores the first @p len bytes of @p str, truncated to @ref capacity. */
+        void assign( const char *str, size_t len ) {
+            if( len > capacity ) {
+                len = capacity;
+            }
+            std::memcpy( data, str, len );
+            std::memset( data + len, 0, sizeof( data ) - len );
+        }
+        void erase() {
+            std::memset( data, 0, sizeof( data ) );
+        }
+
+        bool empty() const {
+            return data[0] == '\0';
+        }
+        size_t length() const {
+            return std::strlen( data );
+        }
+        const char *c_str() const {
+            return data;
+        }
+        std::string str() const {
+            return std::string( data );
+        }
+        char operator[]( const size_t i ) const {
+            return data[i];
+        }
+        bool operator==( const cell_text &rhs ) const {
+            return std::memcmp( data, rhs.data, sizeof( data ) ) == 0;
+        }
+        bool operator==( const char *rhs ) const {
+            return std::strcmp( data, rhs ) == 0;
+        }
+
+    private:
+        char data[capacity + 1];
 };
 
 //Individual lines, so that we can track changed lines
+// Cells have no padding, so they (and whole runs of them) can be compared with memcmp.
 struct cursecell {
-    std::string ch;
     base_color FG = static_cast<base_color>( 0 );
     base_color BG = static_cast<base_color>( 0 );
     font_style FS;
+    cell_text ch;
 
-    cursecell( std::string ch ) : ch( std::move( ch ) ) { }
-    cursecell() : cursecell( std::string( 1, ' ' ) ) { }
+    cursecell( const char *ch ) : ch( ch ) { }
+    cursecell() : cursecell( " " ) { }
 
     bool operator==( const cursecell &b ) const {
-        return FG == b.FG && BG == b.BG && FS == b.FS && ch == b.ch;
+        return std::memcmp( this, &b, sizeof( cursecell ) ) == 0;
     }
 };
+static_assert( sizeof( cursecell ) == 16, "cursecell must stay packed without padding" );
+
+/** Whether the @p count cells at @p a and @p b are all identical. */
+inline bool same_cells( const cursecell *a, const cursecell *b, size_t count )
+{
+    return std::memcmp( a, b, count * sizeof( cursecell ) ) == 0;
+}
 
 struct curseline {
     bool touched;
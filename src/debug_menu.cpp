@@ -17,6 +17,11 @@
 #include "string_formatter.h"
 #include "string_input_popup.h"
 #include "morale_types.h"
+#include "cata_utility.h"
+#include "json.h"
+#include "path_info.h"
+#include "profiler.h"
+#include "turn_arena.h"
 
 #include <algorithm>
 #include <vector>
@@ -443,6 +448,87 @@ void character_edit_menu()
     }
 }
 
+static bool profiler_overlay = false;
+
+static std::vector<std::string> profiler_report()
+{
+    std::vector<std::string> lines;
+    const turn_arena &arena = get_turn_arena();
+    lines.push_back( string_format( _( "turn arena: %d KiB used, %d KiB peak, %d KiB reserved" ),
+                                    int( arena.used() / 1024 ), int( arena.peak() / 1024 ),
+                                    int( arena.capacity() / 1024 ) ) );
+    lines.push_back( string_format( "%-40s %6s %9s %7s", _( "zone" ), _( "calls" ), _( "ms" ),
+                                    _( "allocs" ) ) );
+    for( const profiler::zone_stats &zone : profiler::last_turn() ) {
+        const std::string name = std::string( zone.depth * 2, ' ' ) + zone.name;
+        lines.push_back( string_format( "%-40s %6d %9.3f %7ld", name.c_str(), zone.calls, zone.ms,
+                                        zone.allocations ) );
+    }
+    return lines;
+}
+
+void profiler_menu()
+{
+    enum { P_TOGGLE, P_OVERLAY, P_REPORT, P_DUMP, P_CLEAR };
+    uimenu pmenu;
+    pmenu.return_invalid = true;
+    pmenu.text = _( "Profiler" );
+    pmenu.addentry( P_TOGGLE, true, 'p', profiler::enabled() ? _( "Stop profiling" ) :
+                    _( "Start profiling" ) );
+    pmenu.addentry( P_OVERLAY, true, 'o', profiler_overlay ? _( "Hide overlay" ) :
+                    _( "Show overlay" ) );
+    pmenu.addentry( P_REPORT, true, 'r', _( "Show zones of the last turn" ) );
+    pmenu.addentry( P_DUMP, true, 'd', _( "Write Chrome trace" ) );
+    pmenu.addentry( P_CLEAR, true, 'c', _( "Clear recorded zones" ) );
+    pmenu.query();
+
+    switch( pmenu.ret ) {
+        case P_TOGGLE:
+            profiler::set_enabled( !profiler::enabled() );
+            break;
+        case P_OVERLAY:
+            profiler_overlay = !profiler_overlay;
+            if( profiler_overlay ) {
+                profiler::set_enabled( true );
+            }
+            break;
+        case P_REPORT: {
+            std::ostringstream data;
+            for( const std::string &line : profiler_report() ) {
+                data << line << std::endl;
+            }
+            popup_top( "%s", data.str().c_str() );
+        }
+        break;
+        case P_DUMP: {
+            const std::string path = FILENAMES["config_dir"] + "profile.json";
+            const bool written = write_to_file( path, []( std::ostream & fout ) {
+                JsonOut jsout( fout );
+                profiler::write_chrome_trace( jsout );
+            }, _( "profiler trace" ) );
+            if( written ) {
+                popup( _( "Wrote the trace to %s" ), path.c_str() );
+            }
+        }
+        break;
+        case P_CLEAR:
+            profiler::clear();
+            break;
+    }
+}
+
+void draw_profiler_overlay( const catacurses::window &w )
+{
+    if( !profiler_overlay ) {
+        return;
+    }
+    const std::vector<std::string> lines = profiler_report();
+    const int height = std::min<int>( lines.size(), getmaxy( w ) );
+    for( int y = 0; y < height; y++ ) {
+        trim_and_print( w, y, 0, getmaxx( w ), y < 2 ? c_white : c_light_gray, "%s", lines[y].c_str() );
+    }
+}
+
 const std::string &mission_status_string( mission::mission_status status )
 {
     static const std::map<mission::mission_status, std::string> desc {{
@@ -4,6 +4,10 @@
 #include "enums.h"
 
 class player;
+namespace catacurses
+{
+class window;
+} // namespace catacurses
 
 namespace debug_menu
 {
@@ -19,6 +23,11 @@ void wishmutate( player *p );
 void wishskill( player *p );
 void mutation_wish();
 
+/** Starts and stops the profiler, shows its zones or writes them as a Chrome trace. */
+void profiler_menu();
+/** Prints the profiler zones of the last turn over the window, if the overlay is enabled. */
+void draw_profiler_overlay( const catacurses::window &w );
+
 class mission_debug;
 
 }
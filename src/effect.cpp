@@ -632,8 +632,7 @@ std::string effect::disp_desc(bool reduced) const
     return ret.str();
 }
 
-void effect::decay( std::vector<efftype_id> &rem_ids, std::vector<body_part> &rem_bps,
-                    const time_point &time, const bool player )
+bool effect::decay( const time_point &time, const bool player )
 {
     // Decay duration if not permanent
     if( !is_permanent() ) {
@@ -646,11 +645,8 @@ void effect::decay( std::vector<efftype_id> &rem_ids, std::vector<body_part> &re
         set_intensity( intensity + eff_type->int_decay_step, player );
     }
 
-    // Add to removal list if duration is <= 0
-    if( duration <= 0_turns ) {
-        rem_ids.push_back(get_id());
-        rem_bps.push_back(bp);
-    }
+    // Removed by the caller if duration is <= 0
+    return duration <= 0_turns;
 }
 
 bool effect::use_part_descs() const
@@ -6,6 +6,7 @@
 #include "calendar.h"
 #include "enums.h"
 #include "string_id.h"
+#include <map>
 #include <unordered_map>
 #include <tuple>
 #include <vector>
@@ -162,11 +163,10 @@ class effect
         /** Returns the effect's matching effect_type. */
         const effect_type *get_effect_type() const;
 
-        /** Decays effect durations, pushing their id and bp's back to rem_ids and rem_bps for removal later
-         *  if their duration is <= 0. This is called in the middle of a loop through all effects, which is
-         *  why we aren't allowed to remove the effects here. */
-        void decay( std::vector<efftype_id> &rem_ids, std::vector<body_part> &rem_bps,
-                    const time_point &time, bool player );
+        /** Decays effect durations, returns true if the duration is <= 0 and the effect should be
+         *  removed. This is called in the middle of a loop through all effects, which is why we aren't
+         *  allowed to remove the effect here. */
+        bool decay( const time_point &time, bool player );
 
         /** Returns the remaining duration of an effect. */
         time_duration get_duration() const;
@@ -284,10 +284,17 @@ class effect
 void load_effect_type( JsonObject &jo );
 void reset_effect_types();
 
+/**
+ * The effects of one type a creature has, keyed by body part.
+ *
+ * Almost every effect is either untargeted or on one or two body parts, so a small ordered map
+ * is used instead of a hash map. Its nodes never move, callers may keep references to an effect
+ * while others are added or removed.
+ */
+using effect_bp_map = std::map<body_part, effect>;
+
 // Inheritance here allows forward declaration of the map in class Creature.
-// Storing body_part as an int to make things easier for hash and JSON
-class effects_map : public
-    std::unordered_map<efftype_id, std::unordered_map<body_part, effect, std::hash<int>>>
+class effects_map : public std::unordered_map<efftype_id, effect_bp_map>
 {
 };
 
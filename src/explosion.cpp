@@ -25,8 +25,9 @@
 // For M_PI
 #define _USE_MATH_DEFINES
 #include <cmath>
-#include <queue>
+#include <memory>
 #include <random>
+#include <tuple>
 
 static const itype_id null_itype( "null" );
 
@@ -62,6 +63,120 @@ shrapnel_data load_shrapnel_data( JsonObject &jo )
     return ret;
 }
 
+namespace
+{
+/**
+ * Scratch state of one blast, laid out as a dense grid over the map. A cell only counts for
+ * the blast whose stamp it carries, so the grid is reused between explosions without ever
+ * being cleared.
+ */
+struct blast_grid {
+    struct cell {
+        float dist = 0.0f;
+        // Stamp of the blast that set @ref dist
+        unsigned int reached = 0;
+        // Stamp of the blast that has processed this cell
+        unsigned int closed = 0;
+    };
+
+    std::vector<cell> cells;
+    // The blast may start off the map, only its origin can be out there
+    cell outside;
+    int size = 0;
+    unsigned int stamp = 0;
+    std::vector<std::pair<float, tripoint>> open;
+    // Cells processed by the current blast, in the order they were reached
+    std::vector<tripoint> closed;
+
+    void start( const int map_size ) {
+        if( map_size != size ) {
+            size = map_size;
+            cells.assign( size * size * OVERMAP_LAYERS, cell() );
+            stamp = 0;
+        }
+        if( ++stamp == 0 ) {
+            cells.assign( cells.size(), cell() );
+            stamp = 1;
+        }
+        outside = cell();
+        open.clear();
+        closed.clear();
+    }
+    cell &at( const tripoint &p ) {
+        if( p.x < 0 || p.y < 0 || p.x >= size || p.y >= size ||
+            p.z < -OVERMAP_DEPTH || p.z > OVERMAP_HEIGHT ) {
+            return outside;
+        }
+        return cells[( ( p.z + OVERMAP_DEPTH ) * size + p.y ) * size + p.x];
+    }
+    bool is_closed( const tripoint &p ) {
+        return at( p ).closed == stamp;
+    }
+    float dist( const tripoint &p ) {
+        return at( p ).dist;
+    }
+};
+
+/**
+ * Hands out a scratch object of type T that is kept between explosions. Explosions can set
+ * off further explosions while they are being resolved, so each nesting level gets its own.
+ */
+template<typename T>
+class scratch_lock
+{
+    public:
+        scratch_lock() {
+            std::vector<std::unique_ptr<T>> &objects = pool();
+            if( objects.size() <= depth() ) {
+                objects.emplace_back( new T() );
+            }
+            object = objects[depth()++].get();
+        }
+        ~scratch_lock() {
+            depth()--;
+        }
+        scratch_lock( const scratch_lock & ) = delete;
+        scratch_lock &operator=( const scratch_lock & ) = delete;
+
+        T &operator*() const {
+            return *object;
+        }
+
+    private:
+        static std::vector<std::unique_ptr<T>> &pool() {
+            static std::vector<std::unique_ptr<T>> objects;
+            return objects;
+        }
+        static size_t &depth() {
+            static size_t nesting = 0;
+            return nesting;
+        }
+
+        T *object;
+};
+
+using fragment_layer = fragment_cloud[MAPSIZE * SEEX][MAPSIZE * SEEY];
+
+/**
+ * Obstacle and fragment layers of one shrapnel cast. The fragment layers are zeroed again
+ * while their results are read, so they are clean for the next explosion.
+ */
+struct shrapnel_layers {
+    std::unique_ptr<fragment_layer[]> obstacles;
+    std::unique_ptr<fragment_layer[]> visited;
+    std::array<fragment_layer *, OVERMAP_LAYERS> obstacle_caches;
+    std::array<fragment_layer *, OVERMAP_LAYERS> visited_caches;
+
+    shrapnel_layers() : obstacles( new fragment_layer[OVERMAP_LAYERS] ),
+        visited( new fragment_layer[OVERMAP_LAYERS] ) {
+        for( int z = 0; z < OVERMAP_LAYERS; z++ ) {
+            obstacle_caches[z] = &obstacles[z];
+            visited_caches[z] = &visited[z];
+        }
+    }
+};
+}
+
 // (C1001) Compiler Internal Error on Visual Studio 2015 with Update 2
 void game::do_blast( const tripoint &p, const float power,
                      const float distance_factor, const bool fire )
@@ -80,24 +195,32 @@ void game::do_blast( const tripoint &p, const float power,
 
     m.bash( p, fire ? power : ( 2 * power ), true, false, false );
 
-    std::priority_queue< std::pair<float, tripoint>, std::vector< std::pair<float, tripoint> >, pair_greater_cmp >
-    open;
-    std::set<tripoint> closed;
-    std::map<tripoint, float> dist_map;
-    open.push( std::make_pair( 0.0f, p ) );
-    dist_map[p] = 0.0f;
+    const scratch_lock<blast_grid> lock;
+    blast_grid &grid = *lock;
+    grid.start( m.getmapsize() * SEEX );
+    const pair_greater_cmp open_cmp;
+    const auto push_open = [&grid, &open_cmp]( const float dist, const tripoint & pt ) {
+        grid.open.emplace_back( dist, pt );
+        std::push_heap( grid.open.begin(), grid.open.end(), open_cmp );
+        blast_grid::cell &c = grid.at( pt );
+        c.dist = dist;
+        c.reached = grid.stamp;
+    };
+    push_open( 0.0f, p );
     // Find all points to blast
-    while( !open.empty() ) {
+    while( !grid.open.empty() ) {
+        std::pop_heap( grid.open.begin(), grid.open.end(), open_cmp );
         // Add some random factor to effective distance to make it look cooler
-        const float distance = open.top().first * rng_float( 1.0f, 1.2f );
-        const tripoint pt = open.top().second;
-        open.pop();
+        const float distance = grid.open.back().first * rng_float( 1.0f, 1.2f );
+        const tripoint pt = grid.open.back().second;
+        grid.open.pop_back();
 
-        if( closed.count( pt ) != 0 ) {
+        if( grid.is_closed( pt ) ) {
             continue;
         }
 
-        closed.insert( pt );
+        grid.at( pt ).closed = grid.stamp;
+        grid.closed.push_back( pt );
 
         const float force = power * std::pow( distance_factor, distance );
         if( force <= 1.0f ) {
@@ -114,7 +237,8 @@ void game::do_blast( const tripoint &p, const float power,
         int empty_neighbors = 0;
         for( size_t i = 0; i < 8; i++ ) {
             tripoint dest( pt.x + x_offset[i], pt.y + y_offset[i], pt.z + z_offset[i] );
-            if( closed.count( dest ) == 0 && m.valid_move( pt, dest, false, true ) ) {
+            if( ( !m.inbounds( dest ) || !grid.is_closed( dest ) ) &&
+                m.valid_move( pt, dest, false, true ) ) {
                 empty_neighbors++;
             }
         }
@@ -123,7 +247,7 @@ void game::do_blast( const tripoint &p, const float power,
         // Iterate over all neighbors. Bash all of them, propagate to some
         for( size_t i = 0; i < max_index; i++ ) {
             tripoint dest( pt.x + x_offset[i], pt.y + y_offset[i], pt.z + z_offset[i] );
-            if( closed.count( dest ) != 0 || !m.inbounds( dest ) ) {
+            if( !m.inbounds( dest ) || grid.is_closed( dest ) ) {
                 continue;
             }
 
@@ -154,21 +278,21 @@ void game::do_blast( const tripoint &p, const float power,
                 next_dist += zlev_dist;
             }
 
-            if( dist_map.count( dest ) == 0 || dist_map[dest] > next_dist ) {
-                open.push( std::make_pair( next_dist, dest ) );
-                dist_map[dest] = next_dist;
+            const blast_grid::cell &c = grid.at( dest );
+            if( c.reached != grid.stamp || c.dist > next_dist ) {
+                push_open( next_dist, dest );
             }
         }
     }
 
     // Draw the explosion
     std::map<tripoint, nc_color> explosion_colors;
-    for( auto &pt : closed ) {
+    for( auto &pt : grid.closed ) {
         if( m.impassable( pt ) ) {
             continue;
         }
 
-        const float force = power * std::pow( distance_factor, dist_map.at( pt ) );
+        const float force = power * std::pow( distance_factor, grid.dist( pt ) );
         nc_color col = c_red;
         if( force < 10 ) {
             col = c_white;
@@ -181,8 +305,8 @@ void game::do_blast( const tripoint &p, const float power,
 
     draw_custom_explosion( u.pos(), explosion_colors );
 
-    for( const tripoint &pt : closed ) {
-        const float force = power * std::pow( distance_factor, dist_map.at( pt ) );
+    for( const tripoint &pt : grid.closed ) {
+        const float force = power * std::pow( distance_factor, grid.dist( pt ) );
         if( force < 1.0f ) {
             // Too weak to matter
             continue;
@@ -435,17 +559,13 @@ std::vector<tripoint> game::shrapnel( const tripoint &src, int power,
     proj.range = range;
     proj.proj_effects.insert( "NULL_SOURCE" );
 
-    std::array<fragment_cloud( * )[ MAPSIZE *SEEX ][ MAPSIZE *SEEY ], OVERMAP_LAYERS> obstacle_caches;
-    std::array<fragment_cloud( * )[ MAPSIZE *SEEX ][ MAPSIZE *SEEY ], OVERMAP_LAYERS> visited_caches;
+    const scratch_lock<shrapnel_layers> lock;
+    std::array<fragment_layer *, OVERMAP_LAYERS> &obstacle_caches = ( *lock ).obstacle_caches;
+    std::array<fragment_layer *, OVERMAP_LAYERS> &visited_caches = ( *lock ).visited_caches;
+    // get_cache_ref does not allocate, levels without a cache read a shared stand-in.
     std::array<const bool ( * )[ MAPSIZE *SEEX ][ MAPSIZE *SEEY ], OVERMAP_LAYERS> floor_caches;
     for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
-        const level_cache &cur_cache = m.get_cache_ref( z );
-        // Have to fake out the allocation since you can't 'new' a 2D array whose first dimension is dynamic.
-        obstacle_caches[z + OVERMAP_DEPTH] = ( fragment_cloud( * )[ MAPSIZE * SEEX ][ MAPSIZE * SEEY ] ) new
-                                             fragment_cloud[ MAPSIZE * SEEX * MAPSIZE * SEEY ];
-        visited_caches[z + OVERMAP_DEPTH] = ( fragment_cloud( * )[ MAPSIZE * SEEX ][ MAPSIZE * SEEY ] ) new
-                                            fragment_cloud[ MAPSIZE * SEEX * MAPSIZE * SEEY ];
-        floor_caches[z + OVERMAP_DEPTH] = &cur_cache.floor_cache;
+        floor_caches[z + OVERMAP_DEPTH] = &m.get_cache_ref( z ).floor_cache;
     }
 
     // TODO: Calculate range based on max effective range for projectiles.
@@ -473,20 +593,53 @@ std::vector<tripoint> game::shrapnel( const tripoint &src, int power,
     ( visited_caches, *readonly_obstacle_caches,
       floor_caches, src, 0, initial_cloud );
 
+    const auto effective = []( const fragment_cloud & cloud ) {
+        return cloud.density > MIN_FRAGMENT_DENSITY && cloud.velocity > MIN_EFFECTIVE_VELOCITY;
+    };
+
     // Now visited_caches are populated with density and velocity of fragments.
+    // Find the creatures in their path with one pass over all creatures, ordered like the tiles
+    // below so that each is hit just before the obstacles on its tile are bashed.
+    std::vector<std::pair<tripoint, Creature *>> hit_critters;
+    for( Creature &critter : all_creatures() ) {
+        const tripoint &pos = critter.pos();
+        if( critter.is_hallucination() || critter.is_dead_state() || !m.inbounds( pos ) ) {
+            continue;
+        }
+        const fragment_cloud &cloud = ( *visited_caches[pos.z + OVERMAP_DEPTH] )[pos.x][pos.y];
+        if( effective( cloud ) && ballistic_damage( cloud.velocity, fragment_mass ) > 0 ) {
+            hit_critters.emplace_back( pos, &critter );
+        }
+    }
+    std::sort( hit_critters.begin(), hit_critters.end(),
+    []( const std::pair<tripoint, Creature *> &lhs, const std::pair<tripoint, Creature *> &rhs ) {
+        return std::tie( lhs.first.z, lhs.first.x, lhs.first.y ) <
+               std::tie( rhs.first.z, rhs.first.x, rhs.first.y );
+    } );
+    auto next_critter = hit_critters.begin();
+
+    // Then go over the tiles that were hit, clearing the layers for the next explosion.
     for( int z = start.z; z <= end.z; z++ ) {
-        for( int x = start.x; x <= end.x; x++ ) {
-            for( int y = start.y; y <= end.y; y++ ) {
-                fragment_cloud &cloud = ( *visited_caches[z + OVERMAP_DEPTH] )[x][y];
-                if( cloud.density <= MIN_FRAGMENT_DENSITY ||
-                    cloud.velocity <= MIN_EFFECTIVE_VELOCITY ) {
+        for( int x = 0; x < MAPSIZE * SEEX; x++ ) {
+            for( int y = 0; y < MAPSIZE * SEEY; y++ ) {
+                fragment_cloud &cell = ( *visited_caches[z + OVERMAP_DEPTH] )[x][y];
+                if( cell.density == 0.0f && cell.velocity == 0.0f ) {
+                    continue;
+                }
+                const fragment_cloud cloud = cell;
+                cell = fragment_cloud();
+                if( !effective( cloud ) ) {
                     continue;
                 }
-                distrib.emplace_back( x, y, z );
-                tripoint target( x, y, z );
-                int damage = ballistic_damage( cloud.velocity, fragment_mass );
-                auto critter = critter_at( target );
-                if( damage > 0 && critter && !critter->is_dead_state() ) {
+                const tripoint target( x, y, z );
+                distrib.push_back( target );
+                const int damage = ballistic_damage( cloud.velocity, fragment_mass );
+                for( ; next_critter != hit_critters.end() && next_critter->first == target;
+                     ++next_critter ) {
+                    Creature *critter = next_critter->second;
+                    if( critter->is_dead_state() ) {
+                        continue;
+                    }
                     static std::default_random_engine eng(
                         std::chrono::system_clock::now().time_since_epoch().count() );
                     std::poisson_distribution<> d( cloud.density );
@@ -518,10 +671,6 @@ std::vector<tripoint> game::shrapnel( const tripoint &src, int power,
         }
     }
 
-    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
-        delete [] obstacle_caches[z + OVERMAP_DEPTH];
-        delete [] visited_caches[z + OVERMAP_DEPTH];
-    }
     return distrib;
 }
 
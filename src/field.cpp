@@ -26,6 +26,7 @@
 #include "scent_map.h"
 #include "map_iterator.h"
 #include "morale_types.h"
+#include "profiler.h"
 
 #include <queue>
 #include <algorithm>
@@ -502,6 +503,8 @@ void map::create_burnproducts( const tripoint p, const item &fuel, const units::
 bool map::process_fields()
 {
     bool dirty_transparency_cache = false;
+    // Fires spread, grow and die out
+    fire_sources_dirty = true;
     const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
     const int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
     bool zlev_dirty;
@@ -511,6 +514,7 @@ bool map::process_fields()
             for( int y = 0; y < my_MAPSIZE; y++ ) {
                 submap * const current_submap = get_submap_at_grid( x, y, z );
                 if( current_submap->field_count > 0 ) {
+                    CATA_PROFILE_ZONE( "process_fields_in_submap" );
                     const bool cur_dirty = process_fields_in_submap( current_submap, x, y, z );
                     zlev_dirty |= cur_dirty;
                 }
@@ -4,10 +4,73 @@
 #include "json.h"
 
 #include <map>
+#include <unordered_map>
 #include <algorithm>
 
 std::map<std::string, json_flag> json_flags_all;
 
+/** Defined flags that are not inherited, the exception to the rule */
+static flag_bitset json_flags_not_inherited;
+
+namespace
+{
+
+struct flag_registry {
+    std::unordered_map<std::string, interned_flag> index;
+    std::vector<const std::string *> names;
+};
+
+// Constructed on first use as interned flags are commonly static objects themselves.
+flag_registry &get_registry()
+{
+    static flag_registry registry;
+    return registry;
+}
+
+}
+
+interned_flag::interned_flag( const std::string &id )
+{
+    if( const interned_flag *const known = find( id ) ) {
+        index_ = known->index_;
+        return;
+    }
+    auto &registry = get_registry();
+    index_ = registry.names.size();
+    const auto iter = registry.index.emplace( id, interned_flag( index_ ) ).first;
+    registry.names.push_back( &iter->first );
+}
+
+const interned_flag *interned_flag::find( const std::string &id )
+{
+    const auto &index = get_registry().index;
+    const auto iter = index.find( id );
+    return iter != index.end() ? &iter->second : nullptr;
+}
+
+const std::string &interned_flag::str() const
+{
+    return *get_registry().names[ index_ ];
+}
+
+flag_bitset::flag_bitset( const std::set<std::string> &flags )
+{
+    for( const auto &e : flags ) {
+        set( interned_flag( e ) );
+    }
+}
+
+void flag_bitset::set( const interned_flag &f, bool value )
+{
+    if( f.index() >= bits.size() ) {
+        if( !value ) {
+            return;
+        }
+        bits.resize( f.index() + 1 );
+    }
+    bits[ f.index() ] = value;
+}
+
 const json_flag &json_flag::get( const std::string &id )
 {
     static json_flag null_flag;
@@ -23,6 +86,13 @@ void json_flag::load( JsonObject &jo )
     jo.read( "info", f.info_ );
     jo.read( "conflicts", f.conflicts_ );
     jo.read( "inherit", f.inherit_ );
+
+    json_flags_not_inherited.set( interned_flag( id ), !f.inherit_ );
+}
+
+bool json_flag::inherit( const interned_flag &f )
+{
+    return !json_flags_not_inherited.test( f );
 }
 
 void json_flag::check_consistency()
@@ -44,4 +114,5 @@ void json_flag::check_consistency()
 void json_flag::reset()
 {
     json_flags_all.clear();
+    json_flags_not_inherited = flag_bitset();
 }
@@ -4,9 +4,53 @@
 
 #include <set>
 #include <string>
+#include <vector>
 
 class JsonObject;
 
+/**
+ * Flag string interned to a small integer, assigned the first time each distinct string is seen.
+ * Hot code should keep these as static constants and test them against a @ref flag_bitset
+ * instead of looking up strings.
+ */
+class interned_flag
+{
+    public:
+        explicit interned_flag( const std::string &id );
+
+        /** The flag if @p id was interned before, nullptr otherwise. Never interns @p id itself. */
+        static const interned_flag *find( const std::string &id );
+
+        /** Get identifier of flag as specified in JSON */
+        const std::string &str() const;
+
+        size_t index() const {
+            return index_;
+        }
+
+    private:
+        explicit interned_flag( size_t index ) : index_( index ) {}
+
+        size_t index_;
+};
+
+/** Set of flags stored as one bit per @ref interned_flag */
+class flag_bitset
+{
+    public:
+        flag_bitset() = default;
+        explicit flag_bitset( const std::set<std::string> &flags );
+
+        bool test( const interned_flag &f ) const {
+            return f.index() < bits.size() && bits[ f.index() ];
+        }
+
+        void set( const interned_flag &f, bool value = true );
+
+    private:
+        std::vector<bool> bits;
+};
+
 class json_flag
 {
         friend class DynamicDataLoader;
@@ -30,6 +74,9 @@ class json_flag
             return inherit_;
         }
 
+        /** Is flag inherited by base items? Also true for flags without definition. */
+        static bool inherit( const interned_flag &f );
+
         /** Is this a valid (non-null) flag */
         operator bool() const {
             return !id_.empty();
@@ -12,6 +12,8 @@
 #include "item_category.h"
 #include "veh_type.h"
 #include "options.h"
+#include "profiler.h"
+#include "turn_arena.h"
 #include "auto_pickup.h"
 #include "effect.h"
 #include "bionics.h"
@@ -143,6 +145,15 @@
 const int core_version = 6;
 static constexpr int DANGEROUS_PROXIMITY = 5;
 
+// Options read every turn.
+static const option_handle<bool> opt_autosave( "AUTOSAVE" );
+static const option_handle<int> opt_autosave_turns( "AUTOSAVE_TURNS" );
+static const option_handle<bool> opt_force_redraw( "FORCE_REDRAW" );
+static const option_handle<bool> opt_autosafemode( "AUTOSAFEMODE" );
+static const option_handle<int> opt_autosafemode_turns( "AUTOSAFEMODETURNS" );
+static const option_handle<int> opt_safemode_proximity( "SAFEMODEPROXIMITY" );
+static const option_handle<bool> opt_animations( "ANIMATIONS" );
+
 /** Will be set to true when running unit tests */
 bool test_mode = false;
 
@@ -188,6 +199,7 @@ const efftype_id effect_visuals( "visuals" );
 const efftype_id effect_winded( "winded" );
 
 static const bionic_id bio_remote( "bio_remote" );
+static const bionic_id bio_alarm( "bio_alarm" );
 
 static const trait_id trait_GRAZER( "GRAZER" );
 static const trait_id trait_HIBERNATE( "HIBERNATE" );
@@ -284,7 +296,7 @@ game::game() :
     mostseen(0),
     nextweather( calendar::before_time_starts ),
     remoteveh_cache_time( calendar::before_time_starts ),
-    gamemode(),
+    gamemode( new special_game() ),
     user_action_counter(0),
     tileset_zoom(16),
     weather_override( WEATHER_NULL )
@@ -795,6 +807,7 @@ void game::setup()
     turnssincelastmon = 0; //Auto safe mode init
 
     sounds::reset_sounds();
+    reset_rot_since_cache();
     clear_zombies();
     coming_to_stairs.clear();
     active_npc.clear();
@@ -1438,6 +1451,71 @@ void game::calc_driving_offset(vehicle *veh)
     set_driving_view_offset(point(offset.x, offset.y));
 }
 
+/**
+ * Adds the time until it goes out of scope to the stage, if the game is timing stages.
+ * The stage is also a profiler zone. The whole turn is timed as TURN_STAGE_OTHER (the
+ * do_turn zone) and the other stages take their time back out of it.
+ */
+class turn_stage_timer
+{
+    private:
+        game &gm;
+        turn_stage stage;
+        std::chrono::steady_clock::time_point start;
+#ifndef CATA_NO_PROFILER
+        profiler::scoped_zone zone;
+#endif
+
+    public:
+        turn_stage_timer( game &gm, const turn_stage stage ) : gm( gm ), stage( stage )
+#ifndef CATA_NO_PROFILER
+            , zone( stage == TURN_STAGE_OTHER ? "do_turn" : game::turn_stage_name( stage ) )
+#endif
+        {
+            if( gm.time_turn_stages ) {
+                start = std::chrono::steady_clock::now();
+            }
+        }
+        ~turn_stage_timer() {
+            if( gm.time_turn_stages ) {
+                const std::chrono::duration<double, std::milli> spent = std::chrono::steady_clock::now() - start;
+                gm.turn_stage_ms[stage] += spent.count();
+                if( stage != TURN_STAGE_OTHER ) {
+                    gm.turn_stage_ms[TURN_STAGE_OTHER] -= spent.count();
+                }
+            }
+        }
+};
+
+const char *game::turn_stage_name( const turn_stage stage )
+{
+    switch( stage ) {
+        case TURN_STAGE_MONMOVE:
+            return "monmove";
+        case TURN_STAGE_VEHMOVE:
+            return "vehmove";
+        case TURN_STAGE_FIELDS:
+            return "process_fields";
+        case TURN_STAGE_ACTIVE_ITEMS:
+            return "process_active_items";
+        case TURN_STAGE_LIGHTMAP:
+            return "lightmap";
+        case TURN_STAGE_SCENT:
+            return "scent";
+        case TURN_STAGE_SOUNDS:
+            return "sounds";
+        case TURN_STAGE_WEATHER:
+            return "weather";
+        case TURN_STAGE_PLAYER:
+            return "player";
+        case TURN_STAGE_OTHER:
+            return "other";
+        case NUM_TURN_STAGES:
+            break;
+    }
+    return "unknown";
+}
+
 // MAIN GAME LOOP
 // Returns true if game is over (death, saved, quit, etc)
 bool game::do_turn()
@@ -1445,6 +1523,11 @@ bool game::do_turn()
     if (is_game_over()) {
         return cleanup_at_end();
     }
+    options_manager::next_turn();
+    profiler::next_turn();
+    // Nothing allocated in the arena may outlive the turn that allocated it.
+    get_turn_arena().reset();
+    turn_stage_timer turn_timer( *this, TURN_STAGE_OTHER );
     // Actual stuff
     if( new_game ) {
         new_game = false;
@@ -1486,24 +1569,33 @@ bool game::do_turn()
         m.spawn_monsters( false );
     }
 
-    u.update_body();
+    {
+        turn_stage_timer timer( *this, TURN_STAGE_PLAYER );
+        u.update_body();
+    }
 
     // Auto-save if autosave is enabled
-    if( get_option<bool>( "AUTOSAVE" ) &&
-        calendar::once_every( 1_turns * get_option<int>( "AUTOSAVE_TURNS" ) ) &&
+    if( opt_autosave.get() &&
+        calendar::once_every( 1_turns * opt_autosave_turns.get() ) &&
         !u.is_dead_state()) {
         autosave();
     }
 
-    update_weather();
-    reset_light_level();
+    {
+        turn_stage_timer timer( *this, TURN_STAGE_WEATHER );
+        update_weather();
+        reset_light_level();
+    }
 
     perhaps_add_random_npc();
 
     process_activity();
 
-    // Process sound events into sound markers for display to the player.
-    sounds::process_sound_markers( &u );
+    {
+        turn_stage_timer timer( *this, TURN_STAGE_SOUNDS );
+        // Process sound events into sound markers for display to the player.
+        sounds::process_sound_markers( &u );
+    }
 
     if (!u.in_sleep_state()) {
         if (u.moves > 0 || uquit == QUIT_WATCH) {
@@ -1554,13 +1646,19 @@ bool game::do_turn()
         scent.set( u.pos(), u.scent );
         overmap_buffer.set_scent( u.global_omt_location(),  u.scent );
     }
-    scent.update( u.pos(), m );
+    {
+        turn_stage_timer timer( *this, TURN_STAGE_SCENT );
+        scent.update( u.pos(), m );
+    }
 
     // We need floor cache before checking falling 'n stuff
     m.build_floor_caches();
 
     m.process_falling();
-    m.vehmove();
+    {
+        turn_stage_timer timer( *this, TURN_STAGE_VEHMOVE );
+        m.vehmove();
+    }
 
     // Process power and fuel consumption for all vehicles, including off-map ones.
     // m.vehmove used to do this, but now it only give them moves instead.
@@ -1577,25 +1675,48 @@ bool game::do_turn()
             veh->idle( in_bubble_z && m.inbounds(in_reality.x, in_reality.y) );
         }
     }
-    m.process_fields();
-    m.process_active_items();
+    {
+        turn_stage_timer timer( *this, TURN_STAGE_FIELDS );
+        m.process_fields();
+    }
+    {
+        turn_stage_timer timer( *this, TURN_STAGE_ACTIVE_ITEMS );
+        m.process_active_items();
+    }
     m.creature_in_field( u );
 
-    // Apply sounds from previous turn to monster and NPC AI.
-    sounds::process_sounds();
     // Update vision caches for monsters. If this turns out to be expensive,
     // consider a stripped down cache just for monsters.
-    m.build_map_cache( get_levz(), true );
-    monmove();
+    {
+        turn_stage_timer timer( *this, TURN_STAGE_LIGHTMAP );
+        m.build_map_cache( get_levz(), true );
+    }
+    // Apply sounds from previous turn to monster and NPC AI.
+    // Done after updating the caches as walls in the transparency cache muffle sounds.
+    {
+        turn_stage_timer timer( *this, TURN_STAGE_SOUNDS );
+        sounds::process_sounds();
+    }
+    {
+        turn_stage_timer timer( *this, TURN_STAGE_MONMOVE );
+        monmove();
+    }
     update_stair_monsters();
-    u.process_turn();
-    if( u.moves < 0 && get_option<bool>( "FORCE_REDRAW" ) ) {
+    {
+        turn_stage_timer timer( *this, TURN_STAGE_PLAYER );
+        u.process_turn();
+    }
+    if( u.moves < 0 && opt_force_redraw.get() ) {
         draw();
         refresh_display();
     }
-    u.process_active_items();
+    {
+        turn_stage_timer timer( *this, TURN_STAGE_PLAYER );
+        u.process_active_items();
+    }
 
     if (get_levz() >= 0 && !u.is_underwater()) {
+        turn_stage_timer timer( *this, TURN_STAGE_WEATHER );
         weather_data(weather).effect();
     }
 
@@ -1622,17 +1743,20 @@ bool game::do_turn()
 
     player_was_sleeping = player_is_sleeping;
 
-    u.update_bodytemp();
-    u.update_body_wetness( *weather_precise );
-    u.apply_wetness_morale( temperature );
-    u.do_skill_rust();
+    {
+        turn_stage_timer timer( *this, TURN_STAGE_PLAYER );
+        u.update_bodytemp();
+        u.update_body_wetness( *weather_precise );
+        u.apply_wetness_morale( temperature );
+        u.do_skill_rust();
 
-    if( calendar::once_every( 1_minutes ) ) {
-        u.update_morale();
-    }
+        if( calendar::once_every( 1_minutes ) ) {
+            u.update_morale();
+        }
 
-    if( calendar::once_every( 9_turns ) ) {
-        u.check_and_recover_morale();
+        if( calendar::once_every( 9_turns ) ) {
+            u.check_and_recover_morale();
+        }
     }
 
     sfx::remove_hearing_loss();
@@ -2233,7 +2357,7 @@ input_context game::get_player_input(std::string &action)
 
     user_turn current_turn;
 
-    if (get_option<bool>( "ANIMATIONS" ) ) {
+    if (opt_animations.get() ) {
         int iStartX = (TERRAIN_WINDOW_WIDTH > 121) ? (TERRAIN_WINDOW_WIDTH - 121) / 2 : 0;
         int iStartY = (TERRAIN_WINDOW_HEIGHT > 121) ? (TERRAIN_WINDOW_HEIGHT - 121) / 2 : 0;
         int iEndX = (TERRAIN_WINDOW_WIDTH > 121) ? TERRAIN_WINDOW_WIDTH - (TERRAIN_WINDOW_WIDTH - 121) / 2 :
@@ -3280,7 +3404,7 @@ bool game::handle_action()
             } else {
                 turnssincelastmon = 0;
                 set_safe_mode( SAFE_MODE_OFF );
-                add_msg( m_info, get_option<bool>( "AUTOSAFEMODE" )
+                add_msg( m_info, opt_autosafemode.get()
                     ? _( "Safe mode OFF! (Auto safe mode still enabled!)" ) : _( "Safe mode OFF!" ) );
             }
             if( u.has_effect( effect_laserlocked ) ) {
@@ -4009,6 +4133,8 @@ void game::debug()
                        _( "Teleport - Adjacent overmap" ),   // 32
                        _( "Test trait group" ),        // 33
                        _( "Quit to Main Menu" ),    // 34
+                       _( "Show option reads per turn" ), // 35
+                       _( "Profiler" ),               // 36
                        _( "Cancel" ),
                        NULL );
     refresh_all();
@@ -4374,6 +4500,23 @@ void game::debug()
                 uquit = QUIT_NOSAVED;
             }
             break;
+        case 35: {
+            const std::map<std::string, unsigned int> reads = get_options().reads_last_turn();
+            std::vector<std::pair<std::string, unsigned int>> sorted( reads.begin(), reads.end() );
+            std::stable_sort( sorted.begin(), sorted.end(), []( const std::pair<std::string, unsigned int> &a,
+            const std::pair<std::string, unsigned int> &b ) {
+                return a.second > b.second;
+            } );
+            std::ostringstream data;
+            for( const auto &option : sorted ) {
+                data << string_format( "%6d %s", option.second, option.first.c_str() ) << std::endl;
+            }
+            popup_top( "%s", data.str().c_str() );
+        }
+        break;
+        case 36:
+            debug_menu::profiler_menu();
+            break;
     }
     catacurses::erase();
     refresh_all();
@@ -4613,6 +4756,7 @@ void game::draw()
     if( test_mode ) {
         return;
     }
+    CATA_PROFILE_ZONE( "draw" );
 
     //temporary fix for updating visibility for minimap
     ter_view_z = ( u.pos() + u.view_offset ).z;
@@ -4623,6 +4767,7 @@ void game::draw()
 
     werase( w_terrain );
     draw_ter();
+    debug_menu::draw_profiler_overlay( w_terrain );
     wrefresh( w_terrain );
 }
 
@@ -4745,8 +4890,8 @@ void game::draw_sidebar()
     catacurses::window day_window = sideStyle ? w_status2 : w_status;
     mvwprintz(day_window, 0, sideStyle ? 0 : 41, c_white, _("%s, day %d"),
               calendar::name_season( season_of_year( calendar::turn ) ), day_of_season<int>( calendar::turn ) + 1 );
-    if( safe_mode != SAFE_MODE_OFF || get_option<bool>( "AUTOSAFEMODE" ) ) {
-        int iPercent = turnssincelastmon * 100 / get_option<int>( "AUTOSAFEMODETURNS" );
+    if( safe_mode != SAFE_MODE_OFF || opt_autosafemode.get() ) {
+        int iPercent = turnssincelastmon * 100 / opt_autosafemode_turns.get();
         wmove(w_status, sideStyle ? 4 : 1, getmaxx(w_status) - 4);
         const std::array<std::string, 4> letters = {{ "S", "A", "F", "E" }};
         for (int i = 0; i < 4; i++) {
@@ -5217,7 +5362,7 @@ int game::assign_npc_id()
 
 Creature *game::is_hostile_nearby()
 {
-    int distance = (get_option<int>( "SAFEMODEPROXIMITY" ) <= 0) ? MAX_VIEW_DISTANCE : get_option<int>( "SAFEMODEPROXIMITY" );
+    int distance = (opt_safemode_proximity.get() <= 0) ? MAX_VIEW_DISTANCE : opt_safemode_proximity.get();
     return is_hostile_within(distance);
 }
 
@@ -5263,7 +5408,7 @@ int game::mon_info( const catacurses::window &w )
     const int startrow = use_narrow_sidebar() ? 1 : 0;
 
     int newseen = 0;
-    const int iProxyDist = (get_option<int>( "SAFEMODEPROXIMITY" ) <= 0) ? MAX_VIEW_DISTANCE : get_option<int>( "SAFEMODEPROXIMITY" );
+    const int iProxyDist = (opt_safemode_proximity.get() <= 0) ? MAX_VIEW_DISTANCE : opt_safemode_proximity.get();
     // 7 0 1    unique_types uses these indices;
     // 6 8 2    0-7 are provide by direction_from()
     // 5 4 3    8 is used for local monsters (for when we explain them below)
@@ -5416,9 +5561,9 @@ int game::mon_info( const catacurses::window &w )
         if (safe_mode == SAFE_MODE_ON) {
             set_safe_mode( SAFE_MODE_STOP );
         }
-    } else if ( get_option<bool>( "AUTOSAFEMODE" ) && newseen == 0 ) { // Auto-safe mode
+    } else if ( opt_autosafemode.get() && newseen == 0 ) { // Auto-safe mode
         turnssincelastmon++;
-        if (turnssincelastmon >= get_option<int>( "AUTOSAFEMODETURNS" ) && safe_mode == SAFE_MODE_OFF) {
+        if (turnssincelastmon >= opt_autosafemode_turns.get() && safe_mode == SAFE_MODE_OFF) {
             set_safe_mode( SAFE_MODE_ON );
         }
     }
@@ -5646,19 +5791,21 @@ void game::monmove()
             critter.made_footstep = false;
             // Controlled critters don't make their own plans
             if (!critter.has_effect( effect_controlled)) {
+                CATA_PROFILE_ZONE( "monster_plan" );
                 // Formulate a path to follow
                 critter.plan( monster_factions );
             }
+            CATA_PROFILE_ZONE( "monster_move" );
             critter.move(); // Move one square, possibly hit u
             critter.process_triggers();
             m.creature_in_field( critter );
         }
 
-        if (!critter.is_dead() &&
-            u.has_active_bionic( bionic_id( "bio_alarm" ) ) &&
-            u.power_level >= 25 &&
+        if( !critter.is_dead() &&
             rl_dist( u.pos(), critter.pos() ) <= 5 &&
-            !critter.is_hallucination()) {
+            !critter.is_hallucination() &&
+            u.power_level >= 25 &&
+            u.has_active_bionic( bio_alarm ) ) {
                 u.charge_power(-25);
                 add_msg(m_warning, _("Your motion alarm goes off!"));
                 cancel_activity_query( _( "Your motion alarm goes off!" ) );
@@ -5688,6 +5835,7 @@ void game::monmove()
         m.creature_in_field( guy );
         guy.process_turn();
         while( !guy.is_dead() && !guy.in_sleep_state() && guy.moves > 0 && turns < 10 ) {
+            CATA_PROFILE_ZONE( "npc_move" );
             int moves = guy.moves;
             guy.move();
             if( moves == guy.moves ) {
@@ -9155,7 +9303,7 @@ game::vmenu_ret game::list_monsters( const std::vector<Creature *> &monster_list
                 const auto m = dynamic_cast<monster*>( cCurMon );
                 const std::string monName = (m != nullptr) ? m->name() : "human";
 
-                get_safemode().add_rule(monName, Creature::A_ANY, get_option<int>( "SAFEMODEPROXIMITY" ), RULE_BLACKLISTED);
+                get_safemode().add_rule(monName, Creature::A_ANY, opt_safemode_proximity.get(), RULE_BLACKLISTED);
             }
         } else if (action == "look") {
             tripoint recentered = look_around();
@@ -12222,7 +12370,7 @@ void game::fling_creature(Creature *c, const int &dir, float flvel, bool control
     int steps = 0;
     const bool is_u = (c == &u);
     // Don't animate critters getting bashed if animations are off
-    const bool animate = is_u || get_option<bool>( "ANIMATIONS" );
+    const bool animate = is_u || opt_animations.get();
 
     player *p = dynamic_cast<player*>(c);
 
@@ -60,6 +60,22 @@ enum safe_mode_type {
     SAFE_MODE_STOP = 2, // New monsters spotted, no movement allowed
 };
 
+/** The expensive parts of @ref game::do_turn, timed when game::time_turn_stages is set. */
+enum turn_stage : int {
+    TURN_STAGE_MONMOVE = 0,
+    TURN_STAGE_VEHMOVE,
+    TURN_STAGE_FIELDS,
+    TURN_STAGE_ACTIVE_ITEMS,
+    TURN_STAGE_LIGHTMAP,
+    TURN_STAGE_SCENT,
+    TURN_STAGE_SOUNDS,
+    TURN_STAGE_WEATHER,
+    TURN_STAGE_PLAYER,
+    /** Whatever the turn spends outside the stages above. */
+    TURN_STAGE_OTHER,
+    NUM_TURN_STAGES
+};
+
 enum body_part : int;
 enum weather_type : int;
 enum action_id : int;
@@ -222,6 +238,13 @@ class game
         void start_calendar();
         /** MAIN GAME LOOP. Returns true if game is over (death, saved, quit, etc.). */
         bool do_turn();
+        /**
+         * If set, do_turn adds the wall-clock time (in milliseconds) spent in each
+         * @ref turn_stage to turn_stage_ms. Used by the turn benchmarks.
+         */
+        bool time_turn_stages = false;
+        std::array<double, NUM_TURN_STAGES> turn_stage_ms = {{}};
+        static const char *turn_stage_name( turn_stage stage );
         void draw();
         void draw_ter( bool draw_sounds = true );
         void draw_ter( const tripoint &center, bool looking = false, bool draw_sounds = true );
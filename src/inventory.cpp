@@ -14,6 +14,7 @@
 #include "vehicle.h"
 #include "mapdata.h"
 #include "map_iterator.h"
+#include "visitable_inline.h"
 #include <algorithm>
 #include "messages.h" //for rust message
 #include "output.h"
@@ -979,7 +980,7 @@ const itype_bin &inventory::get_binned_items() const
 
     // Hack warning
     inventory *this_nonconst = const_cast<inventory *>( this );
-    this_nonconst->visit_items( [ this ]( item *e ) {
+    this_nonconst->visit_items_inline( [ this ]( item *e, item * ) {
         binned_items[ e->typeId() ].push_back( e );
         return VisitResponse::NEXT;
     } );
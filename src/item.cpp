@@ -92,6 +92,18 @@ const efftype_id effect_weed_high( "weed_high" );
 const material_id mat_leather( "leather" );
 const material_id mat_kevlar( "kevlar" );
 
+const interned_flag flag_CABLE_SPOOL( "CABLE_SPOOL" );
+const interned_flag flag_FAKE_SMOKE( "FAKE_SMOKE" );
+const interned_flag flag_LITCIG( "LITCIG" );
+const interned_flag flag_MUSHY( "MUSHY" );
+const interned_flag flag_NO_FREEZE( "NO_FREEZE" );
+const interned_flag flag_WET( "WET" );
+const interned_flag flag_VARSIZE( "VARSIZE" );
+const interned_flag flag_SKINTIGHT( "SKINTIGHT" );
+const interned_flag flag_WAIST( "WAIST" );
+const interned_flag flag_OUTER( "OUTER" );
+const interned_flag flag_BELTED( "BELTED" );
+
 std::string const& rad_badge_color(int const rad)
 {
     using pair_t = std::pair<int const, std::string const>;
@@ -2282,11 +2294,13 @@ void item::on_wear( Character &p )
         g->add_artifact_messages( type->artifact->effects_worn );
     }
 
+    p.set_worn_summary_dirty();
     p.on_item_wear( *this );
 }
 
 void item::on_takeoff( Character &p )
 {
+    p.set_worn_summary_dirty();
     p.on_item_takeoff( *this );
 
     if (is_sided()) {
@@ -2936,9 +2950,24 @@ void item::unset_flags()
 
 bool item::has_flag( const std::string &f ) const
 {
-    bool ret = false;
+    if( const interned_flag *const interned = interned_flag::find( f ) ) {
+        return has_flag( *interned );
+    }
+    // All type flags are interned, so only item specific flags of this item or its mods can match.
+    if( !contents.empty() ) {
+        for( const auto e : is_gun() ? gunmods() : toolmods() ) {
+            if( !e->is_gun() && e->has_flag( f ) ) {
+                return true;
+            }
+        }
+    }
+    return !item_tags.empty() && item_tags.count( f );
+}
 
-    if( json_flag::get( f ).inherit() ) {
+bool item::has_flag( const interned_flag &f ) const
+{
+    // mods are stored as contents, skip building the list of them when there can't be any
+    if( !contents.empty() && json_flag::inherit( f ) ) {
         for( const auto e : is_gun() ? gunmods() : toolmods() ) {
             // gunmods fired separately do not contribute to base gun flags
             if( !e->is_gun() && e->has_flag( f ) ) {
@@ -2948,14 +2977,12 @@ bool item::has_flag( const std::string &f ) const
     }
 
     // other item type flags
-    ret = type->item_tags.count(f);
-    if (ret) {
-        return ret;
+    if( type->item_tag_bits.test( f ) ) {
+        return true;
     }
 
     // now check for item specific flags
-    ret = item_tags.count(f);
-    return ret;
+    return !item_tags.empty() && item_tags.count( f.str() );
 }
 
 bool item::has_any_flag( const std::vector<std::string>& flags ) const
@@ -3236,7 +3263,7 @@ int item::get_encumber() const
     }
 
     // Fit checked before changes, fitting shouldn't reduce penalties from patching.
-    if( item_tags.count("FIT") && has_flag( "VARSIZE" ) ) {
+    if( item_tags.count("FIT") && has_flag( flag_VARSIZE ) ) {
         encumber = std::max( encumber / 2, encumber - 10 );
     }
 
@@ -3261,13 +3288,13 @@ int item::get_encumber() const
 
 int item::get_layer() const
 {
-    if( has_flag("SKINTIGHT") ) {
+    if( has_flag( flag_SKINTIGHT ) ) {
         return UNDERWEAR;
-    } else if( has_flag("WAIST") ) {
+    } else if( has_flag( flag_WAIST ) ) {
         return WAIST_LAYER;
-    } else if( has_flag("OUTER") ) {
+    } else if( has_flag( flag_OUTER ) ) {
         return OUTER_LAYER;
-    } else if( has_flag("BELTED") ) {
+    } else if( has_flag( flag_BELTED ) ) {
         return BELTED_LAYER;
     }
     return REGULAR_LAYER;
@@ -5724,6 +5751,12 @@ bool item::needs_processing() const
            is_artifact() || ( is_food() );
 }
 
+bool item::only_rots() const
+{
+    return is_food() && !( item_tags.count( "HOT" ) || item_tags.count( "COLD" ) || item_tags.count( "FROZEN" ) ) &&
+           !type->countdown_action && type->emits.empty();
+}
+
 int item::processing_speed() const
 {
     if( is_food() && !( item_tags.count( "HOT" ) || item_tags.count( "COLD" ) || item_tags.count( "FROZEN" ) ) ) {
@@ -5751,9 +5784,9 @@ bool item::process_food( player * /*carrier*/, const tripoint &pos )
     }
     if( item_tags.count( "FROZEN" ) && item_counter == 0  ) {
         item_tags.erase( "FROZEN" );
-        if( has_flag( "NO_FREEZE" ) && !rotten() ) {
+        if( has_flag( flag_NO_FREEZE ) && !rotten() ) {
             item_tags.insert( "MUSHY" );
-        } else if( has_flag( "NO_FREEZE" ) && has_flag( "MUSHY" ) &&
+        } else if( has_flag( flag_NO_FREEZE ) && has_flag( flag_MUSHY ) &&
             rot < type->comestible->spoils ) {
             rot = type->comestible->spoils;
         }
@@ -6081,7 +6114,7 @@ bool item::process( player *carrier, const tripoint &pos, bool activate )
         g->m.emit_field( pos, e );
     }
 
-    if( has_flag( "FAKE_SMOKE" ) && process_fake_smoke( carrier, pos ) ) {
+    if( has_flag( flag_FAKE_SMOKE ) && process_fake_smoke( carrier, pos ) ) {
         return true;
     }
     if( is_food() &&  process_food( carrier, pos ) ) {
@@ -6090,14 +6123,14 @@ bool item::process( player *carrier, const tripoint &pos, bool activate )
     if( is_corpse() && process_corpse( carrier, pos ) ) {
         return true;
     }
-    if( has_flag( "WET" ) && process_wet( carrier, pos ) ) {
+    if( has_flag( flag_WET ) && process_wet( carrier, pos ) ) {
         // Drying items are never destroyed, but we want to exit so they don't get processed as tools.
         return false;
     }
-    if( has_flag( "LITCIG" ) && process_litcig( carrier, pos ) ) {
+    if( has_flag( flag_LITCIG ) && process_litcig( carrier, pos ) ) {
         return true;
     }
-    if( has_flag( "CABLE_SPOOL" ) ) {
+    if( has_flag( flag_CABLE_SPOOL ) ) {
         // DO NOT process this as a tool! It really isn't!
         return process_cable(carrier, pos);
     }
@@ -66,6 +66,7 @@ class Skill;
 using skill_id = string_id<Skill>;
 class fault;
 using fault_id = string_id<fault>;
+class interned_flag;
 struct quality;
 using quality_id = string_id<quality>;
 struct fire_data;
@@ -929,6 +930,11 @@ class item : public visitable<item>
          * The rate at which an item should be processed, in number of turns between updates.
          */
         int processing_speed() const;
+        /**
+         * Whether processing the item only advances its rot. That is integrated over the whole
+         * time since the last check, so such items can be processed at any later time.
+         */
+        bool only_rots() const;
         /**
          * Process and apply artifact effects. This should be called exactly once each turn, it may
          * modify character stats (like speed, strength, ...), so call it after those have been reset.
@@ -1177,6 +1183,8 @@ class item : public visitable<item>
          */
         /*@{*/
         bool has_flag( const std::string &flag ) const;
+        /** Same as above, but for frequently checked flags: tests a bit instead of a string */
+        bool has_flag( const interned_flag &flag ) const;
         bool has_any_flag( const std::vector<std::string> &flags ) const;
 
         /** Idempotent filter setting an item specific flag. */
@@ -327,6 +327,8 @@ void Item_factory::finalize_pre( itype &obj )
     if( obj.drop_action.get_actor_ptr() != nullptr ) {
         obj.drop_action.get_actor_ptr()->finalize( obj.id );
     }
+
+    obj.item_tag_bits = flag_bitset( obj.item_tags );
 }
 
 void Item_factory::register_cached_uses( const itype &obj )
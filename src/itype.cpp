@@ -77,7 +77,13 @@ long itype::invoke( player &p, item &it, const tripoint &pos, const std::string
         return 0;
     }
 
-    return use->call( p, it, false, pos );
+    // Worn items get switched on and off in place, e.g. by iuse_transform
+    const bool worn = p.is_worn( it );
+    const long charges = use->call( p, it, false, pos );
+    if( worn ) {
+        p.set_worn_summary_dirty();
+    }
+    return charges;
 }
 
 std::string gun_type_type::name() const
@@ -14,6 +14,7 @@
 #include "damage.h"
 #include "translations.h"
 #include "calendar.h"
+#include "flag.h"
 
 #include <string>
 #include <vector>
@@ -736,6 +737,8 @@ public:
     std::set<emit_id> emits;
 
     std::set<std::string> item_tags;
+    /** Same flags as @ref item_tags, set once the type is finalized by the @ref Item_factory */
+    flag_bitset item_tag_bits;
     std::set<matec_id> techniques;
 
     // Minimum stat(s) or skill(s) to use the item
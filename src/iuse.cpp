@@ -1659,6 +1659,8 @@ int iuse::sew_advanced( player *p, item *it, bool, const tripoint & )
     if( mod.item_tags.count( the_mod ) ) {
         if( query_yn( _( "Are you sure?  You will not gain any materials back." ) ) ) {
             mod.item_tags.erase( the_mod );
+            // Linings change the warmth of worn clothes
+            p->set_worn_summary_dirty();
         }
 
         return 0;
@@ -1697,11 +1699,13 @@ int iuse::sew_advanced( player *p, item *it, bool, const tripoint & )
                               mod.tname().c_str() );
         p->consume_items( comps );
         mod.item_tags.insert( the_mod );
+        p->set_worn_summary_dirty();
         return thread_needed;
     }
 
     p->add_msg_if_player( m_good, _( "You modify your %s!" ), mod.tname().c_str() );
     mod.item_tags.insert( the_mod );
+    p->set_worn_summary_dirty();
     p->consume_items( comps );
     return thread_needed / 2;
 }
@@ -2747,6 +2747,7 @@ repair_item_actor::attempt_hint repair_item_actor::repair( player &pl, item &too
             pl.add_msg_if_player( m_good, _( "You take your %s in, improving the fit." ),
                                   fix.tname().c_str() );
             fix.item_tags.insert( "FIT" );
+            pl.set_worn_summary_dirty();
             handle_components( pl, fix, false, false );
             return AS_SUCCESS;
         }
@@ -57,6 +57,7 @@ void map::build_transparency_cache( const int zlev )
     if( !map_cache.transparency_cache_dirty ) {
         return;
     }
+    sees_cache.clear();
 
     // Default to just barely not transparent.
     std::uninitialized_fill_n(
@@ -799,10 +800,14 @@ void map::build_seen_cache( const tripoint &origin, const int target_z )
         std::array<const float (*)[MAPSIZE*SEEX][MAPSIZE*SEEY], OVERMAP_LAYERS> transparency_caches;
         std::array<float (*)[MAPSIZE*SEEX][MAPSIZE*SEEY], OVERMAP_LAYERS> seen_caches;
         std::array<const bool (*)[MAPSIZE*SEEX][MAPSIZE*SEEY], OVERMAP_LAYERS> floor_caches;
+        // Levels of solid rock share one read-only cache. They still have to be cast
+        // through since they cut the spans, but whatever is seen there is thrown away.
+        static float discarded_seen_cache[MAPSIZE*SEEX][MAPSIZE*SEEY];
         for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
-            auto &cur_cache = get_cache( z );
+            const std::unique_ptr<level_cache> &ptr = caches[z + OVERMAP_DEPTH];
+            const level_cache &cur_cache = ptr ? *ptr : solid_level_cache();
             transparency_caches[z + OVERMAP_DEPTH] = &cur_cache.transparency_cache;
-            seen_caches[z + OVERMAP_DEPTH] = &cur_cache.seen_cache;
+            seen_caches[z + OVERMAP_DEPTH] = ptr ? &ptr->seen_cache : &discarded_seen_cache;
             floor_caches[z + OVERMAP_DEPTH] = &cur_cache.floor_cache;
         }
         cast_zlight<float, sight_calc, sight_check, accumulate_transparency>(
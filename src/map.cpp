@@ -44,6 +44,7 @@
 #include "harvest.h"
 #include "input.h"
 #include "options.h"
+#include "profiler.h"
 
 #include <cmath>
 #include <stdlib.h>
@@ -115,10 +116,6 @@ map::map( int mapsize, bool zlev )
         grid.resize( my_MAPSIZE * my_MAPSIZE, nullptr );
     }
 
-    for( auto &ptr : caches ) {
-        ptr = std::unique_ptr<level_cache>( new level_cache() );
-    }
-
     for( auto &ptr : pathfinding_caches ) {
         ptr = std::unique_ptr<pathfinding_cache>( new pathfinding_cache() );
     }
@@ -181,6 +178,9 @@ VehicleList map::get_vehicles() {
 
 void map::reset_vehicle_cache( const int zlev )
 {
+    if( !caches[zlev + OVERMAP_DEPTH] ) {
+        return;
+    }
     clear_vehicle_cache( zlev );
     // Cache all vehicles
     auto &ch = get_cache( zlev );
@@ -247,6 +247,9 @@ void map::update_vehicle_cache( vehicle *veh, const int old_zlevel )
 
 void map::clear_vehicle_cache( const int zlev )
 {
+    if( !caches[zlev + OVERMAP_DEPTH] ) {
+        return;
+    }
     auto &ch = get_cache( zlev );
     while( !ch.veh_cached_parts.empty() ) {
         const auto part = ch.veh_cached_parts.begin();
@@ -260,12 +263,18 @@ void map::clear_vehicle_cache( const int zlev )
 
 void map::clear_vehicle_list( const int zlev )
 {
+    if( !caches[zlev + OVERMAP_DEPTH] ) {
+        return;
+    }
     auto &ch = get_cache( zlev );
     ch.vehicle_list.clear();
 }
 
 void map::update_vehicle_list( submap *const to, const int zlev )
 {
+    if( to->vehicles.empty() ) {
+        return;
+    }
     // Update vehicle data
     auto &ch = get_cache( zlev );
     for( auto & elem : to->vehicles ) {
@@ -333,6 +342,7 @@ void map::vehmove()
     // 15 equals 3 >50mph vehicles, or up to 15 slow (1 square move) ones
     // But 15 is too low for V12 death-bikes, let's put 100 here
     for( int count = 0; count < 100; count++ ) {
+        CATA_PROFILE_ZONE( "vehproceed" );
         if( !vehproceed() ) {
             break;
         }
@@ -1125,7 +1135,7 @@ VehicleList map::get_vehicles( const tripoint &start, const tripoint &end )
 
 optional_vpart_position map::veh_at( const tripoint &p ) const
 {
-    if( !const_cast<map*>( this )->get_cache( p.z ).veh_in_active_range || !inbounds( p ) ) {
+    if( !get_cache_ref( p.z ).veh_in_active_range || !inbounds( p ) ) {
         return optional_vpart_position( cata::nullopt );
     }
 
@@ -1718,6 +1728,9 @@ void map::ter_set( const tripoint &p, const ter_id new_terrain )
     // Set the dirty flags
     const ter_t &old_t = old_id.obj();
     const ter_t &new_t = new_terrain.obj();
+    if( old_t.trap == tr_lava || new_t.trap == tr_lava ) {
+        lava_sources_dirty = true;
+    }
 
     // Hack around ledges in traplocs or else it gets NASTY in z-level mode
     if( old_t.trap != tr_null && old_t.trap != tr_ledge ) {
@@ -4741,6 +4754,7 @@ void map::process_items( bool const active, T processor, std::string const &sign
     for( gz = minz; gz <= maxz; ++gz ) {
         for( gx = 0; gx < my_MAPSIZE; ++gx ) {
             for( gy = 0; gy < my_MAPSIZE; ++gy ) {
+                CATA_PROFILE_ZONE( "process_items_in_submap" );
                 submap *const current_submap = get_submap_at_grid( gp );
                 // Vehicles first in case they get blown up and drop active items on the map.
                 if( !current_submap->vehicles.empty() ) {
@@ -4762,7 +4776,7 @@ void map::process_items_in_submap( submap &current_submap,
     // Get a COPY of the active item list for this submap.
     // If more are added as a side effect of processing, they are ignored this turn.
     // If they are destroyed before processing, they don't get processed.
-    std::list<item_reference> active_items = current_submap.active_items.get();
+    turn_vector<item_reference> active_items = current_submap.active_items.get();
     auto const grid_offset = point {gridp.x * SEEX, gridp.y * SEEY};
     for( auto &active_item : active_items ) {
         if( !current_submap.active_items.has( active_item ) ) {
@@ -5534,6 +5548,9 @@ bool map::add_field( const tripoint &p, const field_id t, int density, const tim
         //Only adding it to the count if it doesn't exist.
         current_submap->field_count++;
     }
+    if( t == fd_fire ) {
+        fire_sources_dirty = true;
+    }
 
     if( g != nullptr && this == &g->m && p == g->u.pos() ) {
         creature_in_field( g->u ); //Hit the player with the field if it spawned on top of them.
@@ -5569,6 +5586,9 @@ void map::remove_field( const tripoint &p, const field_id field_to_remove )
     if( current_submap->fld[lx][ly].removeField( field_to_remove ) ) {
         // Only adjust the count if the field actually existed.
         current_submap->field_count--;
+        if( field_to_remove == fd_fire ) {
+            fire_sources_dirty = true;
+        }
         const auto &fdata = fieldlist[ field_to_remove ];
         for( int i = 0; i < 3; ++i ) {
             if( !fdata.transparent[i] ) {
@@ -5586,6 +5606,95 @@ void map::remove_field( const tripoint &p, const field_id field_to_remove )
     }
 }
 
+const radiant_heat &map::radiant_heat_at( const tripoint &p ) const
+{
+    const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
+    const int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
+    if( fire_sources_dirty || fire_sources_turn != calendar::turn ) {
+        fire_sources.clear();
+        for( int z = minz; z <= maxz; z++ ) {
+            for( int smx = 0; smx < my_MAPSIZE; smx++ ) {
+                for( int smy = 0; smy < my_MAPSIZE; smy++ ) {
+                    const submap *const sm = get_submap_at_grid( smx, smy, z );
+                    if( sm == nullptr || sm->field_count == 0 ) {
+                        continue;
+                    }
+                    for( int sx = 0; sx < SEEX; sx++ ) {
+                        for( int sy = 0; sy < SEEY; sy++ ) {
+                            const field_entry *fire = sm->fld[sx][sy].findFieldc( fd_fire );
+                            if( fire != nullptr && fire->getFieldDensity() > 0 ) {
+                                fire_sources.emplace_back( tripoint( smx * SEEX + sx, smy * SEEY + sy, z ),
+                                                           fire->getFieldDensity() );
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        fire_sources_dirty = false;
+        fire_sources_turn = calendar::turn;
+        radiant_heat_cache.clear();
+    }
+    if( lava_sources_dirty ) {
+        // Lava terrain, lava traps are in traplocs
+        lava_sources.clear();
+        for( int z = minz; z <= maxz; z++ ) {
+            for( int smx = 0; smx < my_MAPSIZE; smx++ ) {
+                for( int smy = 0; smy < my_MAPSIZE; smy++ ) {
+                    const submap *const sm = get_submap_at_grid( smx, smy, z );
+                    if( sm == nullptr || ( sm->is_uniform && sm->ter[0][0].obj().trap != tr_lava ) ) {
+                        continue;
+                    }
+                    for( int sx = 0; sx < SEEX; sx++ ) {
+                        for( int sy = 0; sy < SEEY; sy++ ) {
+                            if( sm->ter[sx][sy].obj().trap == tr_lava ) {
+                                lava_sources.emplace_back( smx * SEEX + sx, smy * SEEY + sy, z );
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        lava_sources_dirty = false;
+        radiant_heat_cache.clear();
+    }
+
+    const auto iter = radiant_heat_cache.find( p );
+    if( iter != radiant_heat_cache.end() ) {
+        return iter->second;
+    }
+    radiant_heat &result = radiant_heat_cache[p];
+    const auto add_source = [this, &p, &result]( const tripoint &source, const int intensity ) {
+        const int dist = square_dist( p, source );
+        if( source.z != p.z || dist > 6 || !sees( p, source, -1 ) ) {
+            return;
+        }
+        // Ensure fire_dist >= 1 to avoid divide-by-zero errors.
+        const int fire_dist = std::max( 1, dist );
+        result.sources.emplace_back( intensity, fire_dist );
+        if( fire_dist <= 1 ) {
+            // Extend limbs/lean over a single adjacent fire to warm up
+            result.adjacent = std::max( result.adjacent, intensity );
+        }
+    };
+    for( const auto &fire : fire_sources ) {
+        add_source( fire.first, fire.second );
+    }
+    // A fire on the lava counts instead of the lava
+    for( const tripoint &lava : lava_sources ) {
+        if( get_field_strength( lava, fd_fire ) == 0 ) {
+            add_source( lava, 3 );
+        }
+    }
+    // Lava terrain is listed above, ter_set puts it into traplocs as well
+    for( const tripoint &lava : trap_locations( tr_lava ) ) {
+        if( ter( lava ).obj().trap != tr_lava && get_field_strength( lava, fd_fire ) == 0 ) {
+            add_source( lava, 3 );
+        }
+    }
+    return result;
+}
+
 void map::add_splatter( const field_id type, const tripoint &where, int intensity )
 {
     if( intensity <= 0 ) {
@@ -6195,10 +6304,32 @@ void map::draw_from_above( const catacurses::window &w, player &u, const tripoin
     }
 }
 
+// Both points must be inbounds and on the same z-level
+static uint64_t los_points( const tripoint &f, const tripoint &t )
+{
+    static_assert( SEEX * MAPSIZE <= 0x1000 && SEEY * MAPSIZE <= 0x1000, "map too big for los_points" );
+    return static_cast<uint64_t>( f.x ) | static_cast<uint64_t>( f.y ) << 12 |
+           static_cast<uint64_t>( t.x ) << 24 | static_cast<uint64_t>( t.y ) << 36 |
+           static_cast<uint64_t>( f.z + OVERMAP_DEPTH ) << 48;
+}
+
 bool map::sees( const tripoint &F, const tripoint &T, const int range ) const
 {
     int dummy = 0;
-    return sees( F, T, range, dummy );
+    if( F.z != T.z || !inbounds( F ) ) {
+        return sees( F, T, range, dummy );
+    }
+    if( ( range >= 0 && range < rl_dist( F, T ) ) || !inbounds( T ) ) {
+        return false;
+    }
+    const los_query query{ los_points( F, T ), 0, 0 };
+    const auto iter = sees_cache.find( query );
+    if( iter != sees_cache.end() ) {
+        return iter->second;
+    }
+    const bool result = sees( F, T, -1, dummy );
+    sees_cache.emplace( query, result );
+    return result;
 }
 
 /**
@@ -6300,6 +6431,14 @@ bool map::clear_path( const tripoint &f, const tripoint &t, const int range,
             !inbounds(t.x, t.y) ) {
             return false; // Out of range!
         }
+        const bool cacheable = inbounds( f );
+        const los_query query{ cacheable ? los_points( f, t ) : 0, cost_min, cost_max };
+        if( cacheable ) {
+            const auto iter = clear_path_cache.find( query );
+            if( iter != clear_path_cache.end() ) {
+                return iter->second;
+            }
+        }
         bool is_clear = true;
         bresenham( f.x, f.y, t.x, t.y, 0,
                    [this, &is_clear, cost_min, cost_max, &t](const point &new_point ) {
@@ -6315,6 +6454,9 @@ bool map::clear_path( const tripoint &f, const tripoint &t, const int range,
                        }
                        return true;
                    } );
+        if( cacheable ) {
+            clear_path_cache.emplace( query, is_clear );
+        }
         return is_clear;
     }
 
@@ -6478,6 +6620,8 @@ void map::shift( const int sx, const int sy )
     const int wz = get_abs_sub().z;
 
     set_abs_sub( absx + sx, absy + sy, wz );
+    fire_sources_dirty = true;
+    lava_sources_dirty = true;
 
 // if player is in vehicle, (s)he must be shifted with vehicle too
     if( g->u.in_vehicle ) {
@@ -6492,7 +6636,7 @@ void map::shift( const int sx, const int sy )
     const int zmin = zlevels ? -OVERMAP_DEPTH : wz;
     const int zmax = zlevels ? OVERMAP_HEIGHT : wz;
     for( int gridz = zmin; gridz <= zmax; gridz++ ) {
-        for( vehicle *veh : get_cache( gridz ).vehicle_list ) {
+        for( vehicle *veh : get_cache_ref( gridz ).vehicle_list ) {
             veh->smx += sx;
             veh->smy += sy;
         }
@@ -6504,7 +6648,7 @@ void map::shift( const int sx, const int sy )
     for( int gridz = zmin; gridz <= zmax; gridz++ ) {
         // Clear vehicle list and rebuild after shift
         clear_vehicle_cache( gridz );
-        get_cache( gridz ).vehicle_list.clear();
+        clear_vehicle_list( gridz );
         if (sx >= 0) {
             for (int gridx = 0; gridx < my_MAPSIZE; gridx++) {
                 if (sy >= 0) {
@@ -6679,6 +6823,8 @@ void map::loadn( const int gridx, const int gridy, const int gridz, const bool u
     const int absx = abs_sub.x + gridx,
               absy = abs_sub.y + gridy;
     const size_t gridn = get_nonant( gridx, gridy, gridz );
+    fire_sources_dirty = true;
+    lava_sources_dirty = true;
 
     dbg(D_INFO) << "map::loadn absx: " << absx << "  absy: " << absy
                 << "  gridn: " << gridn;
@@ -6750,7 +6896,7 @@ void map::loadn( const int gridx, const int gridy, const int gridz, const bool u
     }
 
     // Update vehicle data
-    if( update_vehicles ) {
+    if( update_vehicles && !tmpsub->vehicles.empty() ) {
         auto &map_cache = get_cache( gridz );
         for( auto it : tmpsub->vehicles ) {
             // Only add if not tracking already.
@@ -7107,13 +7253,16 @@ void map::actualize( const int gridx, const int gridy, const int gridz )
     const bool do_funnels = ( gridz >= 0 );
 
     // check spoiled stuff, and fill up funnels while we're at it
+    // Everything below only applies to tiles that have items, furniture, radiation, fields
+    // or particular terrain, so read those straight from the submap and skip the rest.
     for( int x = 0; x < SEEX; x++ ) {
         for( int y = 0; y < SEEY; y++ ) {
             const tripoint pnt( gridx * SEEX + x, gridy * SEEY + y, gridz );
+            const bool has_items = !tmpsub->itm[x][y].empty();
+            const furn_id furn_here = tmpsub->get_furn( x, y );
 
-            const auto &furn = this->furn( pnt ).obj();
             // plants contain a seed item which must not be removed under any circumstances
-            if( !furn.has_flag( "DONT_REMOVE_ROTTEN" ) ) {
+            if( has_items && !furn_here.obj().has_flag( "DONT_REMOVE_ROTTEN" ) ) {
                 remove_rotten_items( tmpsub->itm[x][y], pnt );
             }
 
@@ -7126,19 +7275,27 @@ void map::actualize( const int gridx, const int gridy, const int gridz )
                 traplocs[trap_here].push_back( pnt );
             }
 
-            if( do_funnels ) {
+            if( do_funnels && has_items && ( trap_here != tr_null || ter.trap != tr_null ) ) {
                 fill_funnels( pnt, tmpsub->last_touched );
             }
 
-            grow_plant( pnt );
+            if( furn_here != f_null ) {
+                grow_plant( pnt );
+            }
 
-            restock_fruits( pnt, time_since_last_actualize );
+            if( ter.has_flag( TFLAG_HARVESTED ) ) {
+                restock_fruits( pnt, time_since_last_actualize );
+            }
 
             produce_sap( pnt, time_since_last_actualize );
 
-            rad_scorch( pnt, time_since_last_actualize );
+            if( tmpsub->get_radiation( x, y ) != 0 ) {
+                rad_scorch( pnt, time_since_last_actualize );
+            }
 
-            decay_cosmetic_fields( pnt, time_since_last_actualize );
+            if( tmpsub->fld[x][y].fieldCount() > 0 ) {
+                decay_cosmetic_fields( pnt, time_since_last_actualize );
+            }
         }
     }
 
@@ -7608,25 +7765,29 @@ void map::build_obstacle_cache( const tripoint &start, const tripoint &end,
             for( int smy = min_submap.y; smy <= max_submap.y; ++smy ) {
                 auto const cur_submap = get_submap_at_grid( smx, smy, sz );
                 const int z = sz + OVERMAP_DEPTH;
+                const auto obstacle_at = [cur_submap]( int sx, int sy ) {
+                    int ter_move = cur_submap->get_ter( sx, sy ).obj().movecost;
+                    int furn_move = cur_submap->get_furn( sx, sy ).obj().movecost;
+                    if( ter_move == 0 || furn_move < 0 || ter_move + furn_move == 0 ) {
+                        return fragment_cloud( 1000.0f, 0.0f );
+                    }
+                    // Magic number warning, this is the density of air at sea level at
+                    // some nominal temp and humidity.
+                    // TODO: figure out if our temp/altitude/humidity variation is
+                    // sufficient to bother setting this differently.
+                    return fragment_cloud( 1.2f, 1.0f );
+                };
+                // Every tile of a uniform submap has the same terrain and no furniture.
+                const fragment_cloud uniform_obstacle = cur_submap->is_uniform ? obstacle_at( 0, 0 ) :
+                                                        fragment_cloud();
 
                 // TODO: Init indices to prevent iterating over unused submap sections.
                 for( int sx = 0; sx < SEEX; ++sx ) {
                     for( int sy = 0; sy < SEEY; ++sy ) {
-                        int ter_move = cur_submap->get_ter( sx, sy ).obj().movecost;
-                        int furn_move = cur_submap->get_furn( sx, sy ).obj().movecost;
                         const int x = sx + ( smx * SEEX );
                         const int y = sy + ( smy * SEEY );
-                        if( ter_move == 0 || furn_move < 0 || ter_move + furn_move == 0 ) {
-                            (*obstacle_caches[z])[x][y].velocity = 1000.0f;
-                            (*obstacle_caches[z])[x][y].density = 0.0f;
-                        } else {
-                             // Magic number warning, this is the density of air at sea level at
-			     // some nominal temp and humidity.
-                             // TODO: figure out if our temp/altitude/humidity variation is
-                             // sufficient to bother setting this differently.
-                            (*obstacle_caches[z])[x][y].velocity = 1.2f;
-                            (*obstacle_caches[z])[x][y].density = 1.0f;
-                        }
+                        (*obstacle_caches[z])[x][y] = cur_submap->is_uniform ? uniform_obstacle :
+                                                      obstacle_at( sx, sy );
                     }
                 }
             }
@@ -7664,11 +7825,14 @@ void map::build_obstacle_cache( const tripoint &start, const tripoint &end,
 
 void map::build_floor_cache( const int zlev )
 {
-    auto &ch = get_cache( zlev );
-    if( !ch.floor_cache_dirty ) {
+    // Solid rock has no cache, see build_floor_caches for levels that need one.
+    level_cache *const cache = caches[zlev + OVERMAP_DEPTH].get();
+    if( cache == nullptr || !cache->floor_cache_dirty ) {
         return;
     }
 
+    auto &ch = *cache;
+
     auto &floor_cache = ch.floor_cache;
     std::uninitialized_fill_n(
             &floor_cache[0][0], ( MAPSIZE * SEEX ) * ( MAPSIZE * SEEY ), true );
@@ -7698,6 +7862,15 @@ void map::build_floor_caches()
     const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
     const int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
     for( int z = minz; z <= maxz; z++ ) {
+        // Things fall on levels that changed or were loaded since the last build_map_cache,
+        // so those get their caches here. Solid rock needs none.
+        if( !caches[z + OVERMAP_DEPTH] ) {
+            if( solid_levels.test( z + OVERMAP_DEPTH ) || is_solid_level( z ) ) {
+                solid_levels.set( z + OVERMAP_DEPTH );
+                continue;
+            }
+            get_cache( z );
+        }
         build_floor_cache( z );
     }
 }
@@ -7706,7 +7879,22 @@ void map::build_map_cache( const int zlev, bool skip_lightmap )
 {
     const int minz = zlevels ? -OVERMAP_DEPTH : zlev;
     const int maxz = zlevels ? OVERMAP_HEIGHT : zlev;
+    // Vehicles are written into the transparency caches below
+    sees_cache.clear();
+    clear_path_cache.clear();
+    radiant_heat_cache.clear();
     for( int z = minz; z <= maxz; z++ ) {
+        CATA_PROFILE_ZONE( "build_zlevel_caches" );
+        // Solid rock needs no caches of its own, readers get solid_level_cache() instead.
+        // The level we are on or looking at always gets real ones.
+        if( zlevels && z != zlev && z != g->u.posz() && is_solid_level( z ) ) {
+            std::unique_ptr<level_cache> &ptr = caches[z + OVERMAP_DEPTH];
+            if( !ptr || ptr->vehicle_list.empty() ) {
+                ptr.reset();
+                solid_levels.set( z + OVERMAP_DEPTH );
+                continue;
+            }
+        }
         build_outside_cache( z );
         build_transparency_cache( z );
         build_floor_cache( z );
@@ -7745,12 +7933,29 @@ void map::build_map_cache( const int zlev, bool skip_lightmap )
         }
     }
 
-    build_seen_cache( g->u.pos(), zlev );
+    {
+        CATA_PROFILE_ZONE( "build_seen_cache" );
+        build_seen_cache( g->u.pos(), zlev );
+    }
     if( !skip_lightmap ) {
+        CATA_PROFILE_ZONE( "generate_lightmap" );
         generate_lightmap( zlev );
     }
 }
 
+bool map::is_solid_level( const int zlev ) const
+{
+    for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
+        for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
+            const submap *const sm = get_submap_at_grid( smx, smy, zlev );
+            if( sm == nullptr || !sm->is_uniform || sm->ter[0][0].obj().transparent ) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 std::vector<point> closest_points_first(int radius, point p)
 {
     return closest_points_first(radius, p.x, p.y);
@@ -8292,7 +8497,7 @@ std::list<item_location> map::get_active_items_in_radius( const tripoint &center
 level_cache &map::access_cache( int zlev )
 {
     if( zlev >= -OVERMAP_DEPTH && zlev <= OVERMAP_HEIGHT ) {
-        return *caches[zlev + OVERMAP_DEPTH];
+        return get_cache( zlev );
     }
 
     debugmsg( "access_cache called with invalid z-level: %d", zlev );
@@ -8302,7 +8507,7 @@ level_cache &map::access_cache( int zlev )
 const level_cache &map::access_cache( int zlev ) const
 {
     if( zlev >= -OVERMAP_DEPTH && zlev <= OVERMAP_HEIGHT ) {
-        return *caches[zlev + OVERMAP_DEPTH];
+        return get_cache_ref( zlev );
     }
 
     debugmsg( "access_cache called with invalid z-level: %d", zlev );
@@ -8314,7 +8519,7 @@ level_cache::level_cache()
     const int map_dimensions = SEEX * MAPSIZE * SEEY * MAPSIZE;
     transparency_cache_dirty = true;
     outside_cache_dirty = true;
-    floor_cache_dirty = false;
+    floor_cache_dirty = true;
     std::fill_n( &lm[0][0], map_dimensions, 0.0f );
     std::fill_n( &sm[0][0], map_dimensions, 0.0f );
     std::fill_n( &light_source_buffer[0][0], map_dimensions, 0.0f );
@@ -8328,6 +8533,25 @@ level_cache::level_cache()
     std::fill_n( &veh_exists_at[0][0], map_dimensions, false );
 }
 
+const level_cache &map::solid_level_cache()
+{
+    static const std::unique_ptr<level_cache> solid = []() {
+        std::unique_ptr<level_cache> result( new level_cache() );
+        std::fill_n( &result->floor_cache[0][0], MAPSIZE * SEEX * MAPSIZE * SEEY, true );
+        result->transparency_cache_dirty = false;
+        result->outside_cache_dirty = false;
+        result->floor_cache_dirty = false;
+        return result;
+    }();
+    return *solid;
+}
+
+const level_cache &map::unbuilt_level_cache()
+{
+    static const std::unique_ptr<level_cache> unbuilt( new level_cache() );
+    return *unbuilt;
+}
+
 pathfinding_cache::pathfinding_cache()
 {
     dirty = true;
@@ -8340,6 +8564,7 @@ pathfinding_cache &map::get_pathfinding_cache( int zlev ) const {
 }
 
 void map::set_pathfinding_cache_dirty( const int zlev ) {
+    clear_path_cache.clear();
     if( inbounds_z( zlev ) ) {
         get_pathfinding_cache( zlev ).dirty = true;
     }
@@ -8,8 +8,10 @@
 #include <map>
 #include <memory>
 #include <array>
+#include <bitset>
 #include <list>
 #include <utility>
+#include <unordered_map>
 
 #include "game_constants.h"
 #include "lightmap.h"
@@ -18,6 +20,7 @@
 #include "string_id.h"
 #include "enums.h"
 #include "calendar.h"
+#include "turn_arena.h"
 
 //TODO: include comments about how these variables work. Where are they used. Are they constant etc.
 #define CAMPSIZE 1
@@ -99,7 +102,8 @@ struct wrapped_vehicle {
     vehicle *v;
 };
 
-typedef std::vector<wrapped_vehicle> VehicleList;
+// Allocated from the turn arena, don't keep it beyond the current turn.
+typedef turn_vector<wrapped_vehicle> VehicleList;
 typedef std::string items_location;
 struct vehicle_prototype;
 using vproto_id = string_id<vehicle_prototype>;
@@ -187,6 +191,14 @@ struct level_cache {
     std::set<vehicle *> vehicle_list;
 };
 
+/** Heat radiating onto a tile, see map::radiant_heat_at. */
+struct radiant_heat {
+    /** Fires and lava in sight as intensity-distance pairs, distances are at least 1. */
+    std::vector<std::pair<int, int>> sources;
+    /** Intensity of the strongest source next to the tile, to lean over. */
+    int adjacent = 0;
+};
+
 /**
  * Manage and cache data about a part of the map.
  *
@@ -230,26 +242,45 @@ class map
          */
         /*@{*/
         void set_transparency_cache_dirty( const int zlev ) {
+            // Unallocated caches are built from scratch anyway.
             if( inbounds_z( zlev ) ) {
-                get_cache( zlev ).transparency_cache_dirty = true;
+                solid_levels.reset( zlev + OVERMAP_DEPTH );
+                if( caches[zlev + OVERMAP_DEPTH] ) {
+                    caches[zlev + OVERMAP_DEPTH]->transparency_cache_dirty = true;
+                }
             }
         }
 
         void set_outside_cache_dirty( const int zlev ) {
+            // Unallocated caches are built from scratch anyway.
             if( inbounds_z( zlev ) ) {
-                get_cache( zlev ).outside_cache_dirty = true;
+                solid_levels.reset( zlev + OVERMAP_DEPTH );
+                if( caches[zlev + OVERMAP_DEPTH] ) {
+                    caches[zlev + OVERMAP_DEPTH]->outside_cache_dirty = true;
+                }
             }
         }
 
         void set_floor_cache_dirty( const int zlev ) {
+            // Unallocated caches are built from scratch anyway.
             if( inbounds_z( zlev ) ) {
-                get_cache( zlev ).floor_cache_dirty = true;
+                solid_levels.reset( zlev + OVERMAP_DEPTH );
+                if( caches[zlev + OVERMAP_DEPTH] ) {
+                    caches[zlev + OVERMAP_DEPTH]->floor_cache_dirty = true;
+                }
             }
         }
 
         void set_pathfinding_cache_dirty( const int zlev );
         /*@}*/
 
+        /**
+         * Fires and lava within 6 tiles of `p` on its z-level that `p` sees.
+         * The sources are collected once per turn (or when fire fields, traps or terrain change)
+         * and the result is shared by all characters standing on `p`.
+         */
+        const radiant_heat &radiant_heat_at( const tripoint &p ) const;
+
 
         /**
          * Callback invoked when a vehicle has moved.
@@ -1356,6 +1387,7 @@ class map
         void build_transparency_cache( int zlev );
     public:
         void build_outside_cache( int zlev );
+        /** Rebuilds a dirty floor cache, levels without a cache are left alone. */
         void build_floor_cache( int zlev );
         // We want this visible in `game`, because we want it built earlier in the turn than the rest
         void build_floor_caches();
@@ -1385,6 +1417,37 @@ class map
     private:
         field &get_field( const tripoint &p );
 
+        /**
+         * Results of same-level @ref sees and @ref clear_path calls, keyed on both points (range
+         * is checked before the lookup). Sight results only depend on the transparency caches
+         * and are dropped when those are rebuilt. Path results are dropped together with the
+         * pathfinding caches and when the map caches are rebuilt, after vehicles have moved.
+         */
+        struct los_query {
+            uint64_t points;
+            int cost_min;
+            int cost_max;
+
+            bool operator==( const los_query &other ) const {
+                return points == other.points && cost_min == other.cost_min && cost_max == other.cost_max;
+            }
+        };
+        struct los_query_hash {
+            size_t operator()( const los_query &q ) const {
+                return std::hash<uint64_t>()( q.points ) ^ ( q.cost_min * 31 + q.cost_max );
+            }
+        };
+        mutable std::unordered_map<los_query, bool, los_query_hash> sees_cache;
+        mutable std::unordered_map<los_query, bool, los_query_hash> clear_path_cache;
+
+        // Heat sources for radiant_heat_at, the fires are collected again every turn
+        mutable std::vector<std::pair<tripoint, int>> fire_sources;
+        mutable std::vector<tripoint> lava_sources;
+        mutable bool fire_sources_dirty = true;
+        mutable bool lava_sources_dirty = true;
+        mutable time_point fire_sources_turn = calendar::before_time_starts;
+        mutable std::unordered_map<tripoint, radiant_heat> radiant_heat_cache;
+
         /**
          * Get the submap pointer with given index in @ref grid, the index must be valid!
          */
@@ -1533,24 +1596,44 @@ class map
          */
         std::vector< std::vector<tripoint> > traplocs;
         /**
-         * Holds caches for visibility, light, transparency and vehicles
+         * Holds caches for visibility, light, transparency and vehicles.
+         * Allocated on first use, levels made only of uniform solid submaps never get one,
+         * see @ref build_map_cache.
          */
         std::array< std::unique_ptr<level_cache>, OVERMAP_LAYERS > caches;
+        /** Levels known to be solid rock, without caches of their own until they change. */
+        std::bitset<OVERMAP_LAYERS> solid_levels;
 
         mutable std::array< std::unique_ptr<pathfinding_cache>, OVERMAP_LAYERS > pathfinding_caches;
 
         // Note: no bounds check
         level_cache &get_cache( int zlev ) {
-            return *caches[zlev + OVERMAP_DEPTH];
+            std::unique_ptr<level_cache> &ptr = caches[zlev + OVERMAP_DEPTH];
+            if( !ptr ) {
+                ptr.reset( new level_cache() );
+                solid_levels.reset( zlev + OVERMAP_DEPTH );
+            }
+            return *ptr;
         }
+        /** Whether every submap of the level is a uniform block of opaque terrain. */
+        bool is_solid_level( int zlev ) const;
+        /** Stands in for levels of solid rock: opaque, with a floor everywhere and never seen. */
+        static const level_cache &solid_level_cache();
+        /** Stands in for levels that were not built yet, as a freshly allocated cache would. */
+        static const level_cache &unbuilt_level_cache();
 
         pathfinding_cache &get_pathfinding_cache( int zlev ) const;
 
         visibility_variables visibility_variables_cache;
 
     public:
+        /** Never allocates, levels without a cache get one in build_floor_caches or build_map_cache. */
         const level_cache &get_cache_ref( int zlev ) const {
-            return *caches[zlev + OVERMAP_DEPTH];
+            const std::unique_ptr<level_cache> &ptr = caches[zlev + OVERMAP_DEPTH];
+            if( ptr ) {
+                return *ptr;
+            }
+            return solid_levels.test( zlev + OVERMAP_DEPTH ) ? solid_level_cache() : unbuilt_level_cache();
         }
 
         const pathfinding_cache &get_pathfinding_cache_ref( int zlev ) const;
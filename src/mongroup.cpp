@@ -1,5 +1,6 @@
 #include "mongroup.h"
 #include <vector>
+#include <algorithm>
 
 #include "rng.h"
 #include "debug.h"
@@ -55,6 +56,70 @@ void mongroup::clear()
     monsters.clear();
 }
 
+mongroup_store::handle mongroup_store::insert( const mongroup &group )
+{
+    handle h;
+    if( free_slots.empty() ) {
+        h = groups.size();
+        groups.push_back( group );
+    } else {
+        h = free_slots.back();
+        free_slots.pop_back();
+        groups[h] = group;
+    }
+    index.emplace( group.pos, h );
+    if( group.horde ) {
+        horde_handles.push_back( h );
+    }
+    return h;
+}
+
+void mongroup_store::unindex( const handle h )
+{
+    const auto range = index.equal_range( groups[h].pos );
+    for( auto it = range.first; it != range.second; ++it ) {
+        if( it->second == h ) {
+            index.erase( it );
+            return;
+        }
+    }
+    debugmsg( "monster group %d is missing from the position index", static_cast<int>( h ) );
+}
+
+void mongroup_store::erase( const handle h )
+{
+    unindex( h );
+    if( groups[h].horde ) {
+        const auto iter = std::find( horde_handles.begin(), horde_handles.end(), h );
+        if( iter != horde_handles.end() ) {
+            *iter = horde_handles.back();
+            horde_handles.pop_back();
+        }
+    }
+    // Release the monsters now, the slot itself is reused by a later insert.
+    groups[h] = mongroup();
+    free_slots.push_back( h );
+}
+
+void mongroup_store::move( const handle h, const tripoint &new_pos )
+{
+    mongroup &mg = groups[h];
+    if( mg.pos == new_pos ) {
+        return;
+    }
+    unindex( h );
+    mg.pos = new_pos;
+    index.emplace( new_pos, h );
+}
+
+void mongroup_store::clear()
+{
+    groups.clear();
+    free_slots.clear();
+    index.clear();
+    horde_handles.clear();
+}
+
 const MonsterGroup &MonsterGroupManager::GetUpgradedMonsterGroup( const mongroup_id &group )
 {
     const MonsterGroup *groupptr = &group.obj();
@@ -3,6 +3,7 @@
 #define MONGROUP_H
 
 #include <vector>
+#include <deque>
 #include <map>
 #include <set>
 #include <string>
@@ -163,6 +164,84 @@ struct mongroup {
     void serialize( JsonOut &jsout ) const;
 };
 
+/**
+ * Owns the monster groups of an overmap.
+ * Groups live in stable slots and are addressed by handles that stay valid (as do references
+ * to the group) until that group is erased. A position index maps each group location to its
+ * handles, so moving a group only updates the index and never copies the group itself.
+ * Hordes are also listed separately, as they are the only groups that move or react to
+ * signals, and usually a small fraction of all groups.
+ */
+class mongroup_store
+{
+    public:
+        using handle = size_t;
+
+        handle insert( const mongroup &group );
+        void erase( handle h );
+        /** Moves the group to @p new_pos, updating its position and the index. */
+        void move( handle h, const tripoint &new_pos );
+        void clear();
+
+        mongroup &get( const handle h ) {
+            return groups[h];
+        }
+        const mongroup &get( const handle h ) const {
+            return groups[h];
+        }
+        size_t size() const {
+            return index.size();
+        }
+        /** Handles of all hordes, in no particular order. */
+        const std::vector<handle> &hordes() const {
+            return horde_handles;
+        }
+
+        /** Calls @p func for every group, ordered by position. */
+        template<typename F>
+        void for_each( F func ) const {
+            for( const auto &e : index ) {
+                func( groups[e.second] );
+            }
+        }
+        /** Calls @p func for every group at @p p. */
+        template<typename F>
+        void for_each_at( const tripoint &p, F func ) {
+            const auto range = index.equal_range( p );
+            for( auto it = range.first; it != range.second; ++it ) {
+                func( groups[it->second] );
+            }
+        }
+        template<typename F>
+        void for_each_at( const tripoint &p, F func ) const {
+            const auto range = index.equal_range( p );
+            for( auto it = range.first; it != range.second; ++it ) {
+                func( groups[it->second] );
+            }
+        }
+        /** Erases every group for which @p pred returns true. */
+        template<typename P>
+        void erase_if( P pred ) {
+            std::vector<handle> doomed;
+            for( const auto &e : index ) {
+                if( pred( groups[e.second] ) ) {
+                    doomed.push_back( e.second );
+                }
+            }
+            for( const handle h : doomed ) {
+                erase( h );
+            }
+        }
+
+    private:
+        void unindex( handle h );
+
+        std::deque<mongroup> groups;
+        std::vector<handle> free_slots;
+        std::multimap<tripoint, handle> index;
+        std::vector<handle> horde_handles;
+};
+
 class MonsterGroupManager
 {
     public:
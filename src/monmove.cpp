@@ -210,6 +210,12 @@ void monster::plan( const mfactions &factions )
     bool group_morale = has_flag( MF_GROUP_MORALE ) && morale < type->morale;
     bool swarms = has_flag( MF_SWARMS );
     auto mood = attitude();
+    // Creatures beyond this can't be seen (see Creature::sees), rate_target would rate them INT_MAX.
+    // Checking it first avoids the line of sight checks for most of a big fight.
+    const int max_sight = std::max( 1, std::max( sight_range( DAYLIGHT_LEVEL ), sight_range( 0 ) ) );
+    const auto out_of_sight = [this, max_sight]( const Creature & c ) {
+        return square_dist( pos(), c.pos() ) > max_sight;
+    };
 
     // If we can see the player, move toward them or flee, simpleminded animals are too dumb to follow the player.
     if( friendly == 0 && sees( g->u ) && !has_flag( MF_PET_WONT_FOLLOW ) ) {
@@ -223,7 +229,7 @@ void monster::plan( const mfactions &factions )
     } else if( friendly != 0 && !docile ) {
         // Target unfriendly monsters, only if we aren't interacting with the player.
         for( monster &tmp : g->all_monsters() ) {
-            if( tmp.friendly == 0 ) {
+            if( tmp.friendly == 0 && !out_of_sight( tmp ) ) {
                 float rating = rate_target( tmp, dist, smart_planning );
                 if( rating < dist ) {
                     target = &tmp;
@@ -273,6 +279,9 @@ void monster::plan( const mfactions &factions )
 
             for( monster *const mon_ptr : fac.second ) {
                 monster &mon = *mon_ptr;
+                if( out_of_sight( mon ) ) {
+                    continue;
+                }
                 float rating = rate_target( mon, dist, smart_planning );
                 if( rating < dist ) {
                     target = &mon;
@@ -301,6 +310,9 @@ void monster::plan( const mfactions &factions )
     if( group_morale || swarms ) {
         for( monster *const mon_ptr : myfaction_iter->second ) {
             monster &mon = *mon_ptr;
+            if( out_of_sight( mon ) ) {
+                continue;
+            }
             float rating = rate_target( mon, dist, smart_planning );
             if( group_morale && rating <= 10 ) {
                 morale += 10 - rating;
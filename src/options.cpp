@@ -54,6 +54,91 @@ options_manager &get_options()
     return single_instance;
 }
 
+unsigned int options_manager::value_generation = 0;
+unsigned int options_manager::read_turn = 0;
+
+void options_manager::next_turn()
+{
+    read_turn++;
+    option_handle_base::next_turn();
+}
+
+std::map<std::string, unsigned int> options_manager::reads_last_turn() const
+{
+    std::map<std::string, unsigned int> result;
+    const auto add_reads = [&result]( const options_container & opts ) {
+        for( const auto &opt : opts ) {
+            if( const unsigned int reads = opt.second.reads_last_turn() ) {
+                result[opt.first] += reads;
+            }
+        }
+    };
+    add_reads( options );
+    if( world_generator && world_generator->active_world ) {
+        add_reads( world_generator->active_world->WORLD_OPTIONS );
+    }
+    for( const option_handle_base *handle : option_handle_base::all() ) {
+        if( handle->reads_last_turn() > 0 ) {
+            result[handle->name()] += handle->reads_last_turn();
+        }
+    }
+    return result;
+}
+
+void options_manager::add_change_listener( const std::string &name,
+        std::function<void()> callback )
+{
+    const std::string current = has_option( name ) ? get_option( name ).getValue() : std::string();
+    listeners.push_back( change_listener{ name, current, std::move( callback ) } );
+}
+
+void options_manager::notify_listeners()
+{
+    for( auto &listener : listeners ) {
+        if( !has_option( listener.name ) ) {
+            continue;
+        }
+        const std::string current = get_option( listener.name ).getValue();
+        if( current != listener.last_value ) {
+            listener.last_value = current;
+            listener.callback();
+        }
+    }
+}
+
+static std::vector<const option_handle_base *> &option_handles()
+{
+    static std::vector<const option_handle_base *> handles;
+    return handles;
+}
+
+option_handle_base::option_handle_base( const std::string &name )
+    : name_( name ), generation( options_manager::value_generation - 1 )
+{
+    option_handles().push_back( this );
+}
+
+option_handle_base::~option_handle_base()
+{
+    auto &handles = option_handles();
+    handles.erase( std::remove( handles.begin(), handles.end(), this ), handles.end() );
+}
+
+const std::vector<const option_handle_base *> &option_handle_base::all()
+{
+    return option_handles();
+}
+
+void option_handle_base::next_turn()
+{
+    for( const option_handle_base *handle : option_handles() ) {
+        // Only the counters change, the handle itself stays logically const.
+        option_handle_base &h = const_cast<option_handle_base &>( *handle );
+        h.last_turn_reads = h.reads;
+        h.reads = 0;
+    }
+}
+
 options_manager::options_manager()
 {
     mMigrateOption = { {"DELETE_WORLD", { "WORLD_END", { {"no", "keep" }, {"yes", "delete"} } } } };
@@ -597,6 +682,7 @@ int options_manager::cOpt::getMaxLength() const
 //set to next item
 void options_manager::cOpt::setNext()
 {
+    mark_values_changed();
     if (sType == "string_select") {
         int iNext = getItemPos(sSet) + 1;
         if (iNext >= (int)vItems.size()) {
@@ -641,6 +727,7 @@ void options_manager::cOpt::setNext()
 //set to previous item
 void options_manager::cOpt::setPrev()
 {
+    mark_values_changed();
     if (sType == "string_select") {
         int iPrev = getItemPos(sSet) - 1;
         if (iPrev < 0) {
@@ -682,6 +769,7 @@ void options_manager::cOpt::setPrev()
 //set value
 void options_manager::cOpt::setValue(float fSetIn)
 {
+    mark_values_changed();
     if (sType != "float") {
         debugmsg("tried to set a float value to a %s option", sType.c_str());
         return;
@@ -695,6 +783,7 @@ void options_manager::cOpt::setValue(float fSetIn)
 //set value
 void options_manager::cOpt::setValue( int iSetIn )
 {
+    mark_values_changed();
     if( sType != "int" ) {
         debugmsg( "tried to set an int value to a %s option", sType.c_str() );
         return;
@@ -708,6 +797,7 @@ void options_manager::cOpt::setValue( int iSetIn )
 //set value
 void options_manager::cOpt::setValue(std::string sSetIn)
 {
+    mark_values_changed();
     if (sType == "string_select") {
         if (getItemPos(sSetIn) != -1) {
             sSet = sSetIn;
@@ -1625,6 +1715,7 @@ void options_manager::init()
             bLastLineEmpty = bThisLineEmpty;
         }
     }
+    mark_values_changed();
 }
 
 #ifdef TILES
@@ -2031,6 +2122,9 @@ std::string options_manager::show(bool ingame, const bool world_options_only)
             }
         }
     }
+    // The menu edits options in place and may have restored them wholesale.
+    mark_values_changed();
+    notify_listeners();
 
     if( lang_changed ) {
         set_language();
@@ -2163,6 +2257,8 @@ void options_manager::load()
     log_from_top = ::get_option<std::string>( "LOG_FLOW" ) == "new_top";
     message_ttl = ::get_option<int>( "MESSAGE_TTL" );
     fov_3d = ::get_option<bool>( "FOV_3D" );
+
+    notify_listeners();
 }
 
 bool options_manager::load_legacy()
@@ -4,6 +4,7 @@
 
 #include <string>
 #include <map>
+#include <functional>
 #include <utility>
 #include <unordered_map>
 #include <vector>
@@ -101,7 +102,31 @@ class options_manager
                 std::string getPrerequisite() const;
                 bool hasPrerequisite() const;
 
+                /** Counts a read through @ref get_option for the debug menu. */
+                void count_read() const {
+                    roll_reads();
+                    reads++;
+                }
+                /** Reads through @ref get_option during the turn before the current one. */
+                unsigned int reads_last_turn() const {
+                    roll_reads();
+                    return last_turn_reads;
+                }
+
             private:
+                // The counters start over lazily on the first read of a new turn, so that
+                // options_manager::next_turn doesn't have to visit every option.
+                void roll_reads() const {
+                    if( read_turn != options_manager::read_turn ) {
+                        last_turn_reads = read_turn + 1 == options_manager::read_turn ? reads : 0;
+                        reads = 0;
+                        read_turn = options_manager::read_turn;
+                    }
+                }
+                mutable unsigned int reads = 0;
+                mutable unsigned int last_turn_reads = 0;
+                mutable unsigned int read_turn = 0;
+
                 std::string sName;
                 std::string sPage;
                 // The *untranslated* displayed option name ( short string ).
@@ -146,6 +171,31 @@ class options_manager
 
         typedef std::unordered_map<std::string, cOpt> options_container;
 
+        /**
+         * Bumped whenever any option value (global or world) may have changed.
+         * @ref option_handle compares against it to know when to refresh its cached value.
+         */
+        static unsigned int value_generation;
+        static void mark_values_changed() {
+            value_generation++;
+        }
+
+        /** Starts counting option reads for a new turn, see @ref reads_last_turn. */
+        static void next_turn();
+        /**
+         * Reads of each option during the last turn, through @ref get_option and through
+         * @ref option_handle. Options that were not read are left out.
+         */
+        std::map<std::string, unsigned int> reads_last_turn() const;
+
+        /**
+         * Registers @p callback to be run by @ref notify_listeners when the value of
+         * option @p name differs from the one it had on the previous notification.
+         */
+        void add_change_listener( const std::string &name, std::function<void()> callback );
+        /** Runs the change listeners of all options whose value changed. */
+        void notify_listeners();
+
         void init();
         void load();
         bool save();
@@ -218,6 +268,15 @@ class options_manager
                   const std::string &format = "%.2f" );
 
     private:
+        static unsigned int read_turn;
+
+        struct change_listener {
+            std::string name;
+            std::string last_value;
+            std::function<void()> callback;
+        };
+        std::vector<change_listener> listeners;
+
         options_container options;
         // first is page id, second is untranslated page name
         std::vector<std::pair<std::string, std::string>> vPages;
@@ -243,7 +302,65 @@ options_manager &get_options();
 template<typename T>
 inline T get_option( const std::string &name )
 {
-    return get_options().get_option( name ).value_as<T>();
+    const options_manager::cOpt &opt = get_options().get_option( name );
+    opt.count_read();
+    return opt.value_as<T>();
 }
 
+/**
+ * Untyped part of @ref option_handle. Keeps a registry of all handles, so the number
+ * of reads of each option can be inspected (see the debug menu).
+ */
+class option_handle_base
+{
+    public:
+        const std::string &name() const {
+            return name_;
+        }
+        /** Reads during the turn before the last call to @ref next_turn. */
+        unsigned int reads_last_turn() const {
+            return last_turn_reads;
+        }
+
+        static const std::vector<const option_handle_base *> &all();
+        /** Starts counting reads for a new turn, called by options_manager::next_turn. */
+        static void next_turn();
+
+    protected:
+        explicit option_handle_base( const std::string &name );
+        ~option_handle_base();
+        option_handle_base( const option_handle_base & ) = delete;
+        option_handle_base &operator=( const option_handle_base & ) = delete;
+
+        std::string name_;
+        mutable unsigned int reads = 0;
+        unsigned int last_turn_reads = 0;
+        mutable unsigned int generation;
+};
+
+/**
+ * A typed handle to a single option, meant to be created once (usually as a static
+ * at file scope) and read in hot paths instead of @ref get_option.
+ * The value is looked up by name only when the options have changed since the last read.
+ */
+template<typename T>
+class option_handle : public option_handle_base
+{
+    public:
+        explicit option_handle( const std::string &name ) : option_handle_base( name ) { }
+
+        T get() const {
+            reads++;
+            if( generation != options_manager::value_generation ) {
+                // Not through ::get_option, the read was already counted above.
+                value = get_options().get_option( name_ ).value_as<T>();
+                generation = options_manager::value_generation;
+            }
+            return value;
+        }
+
+    private:
+        mutable T value = T();
+};
+
 #endif
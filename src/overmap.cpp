@@ -60,6 +60,8 @@ using oter_type_str_id = string_id<oter_type_t>;
 ter_furn_id::ter_furn_id() : ter( t_null ), furn( f_null ) { }
 
 //Classic Extras is for when you have special zombies turned off.
+static const option_handle<bool> opt_wander_spawns( "WANDER_SPAWNS" );
+
 static const std::set<std::string> classic_extras = { "mx_helicopter", "mx_military","mx_roadblock", "mx_drugdeal", "mx_supplydrop", "mx_minefield", "mx_crater", "mx_collegekids" };
 
 #include "omdata.h"
@@ -1296,19 +1298,19 @@ bool overmap::is_explored(int const x, int const y, int const z) const
 
 bool overmap::mongroup_check(const mongroup &candidate) const
 {
-    const auto matching_range = zg.equal_range(candidate.pos);
-    return std::find_if( matching_range.first, matching_range.second,
-        [candidate](std::pair<tripoint, mongroup> match) {
-            // This is extra strict since we're using it to test serialization.
-            return candidate.type == match.second.type && candidate.pos == match.second.pos &&
-                candidate.radius == match.second.radius &&
-                candidate.population == match.second.population &&
-                candidate.target == match.second.target &&
-                candidate.interest == match.second.interest &&
-                candidate.dying == match.second.dying &&
-                candidate.horde == match.second.horde &&
-                candidate.diffuse == match.second.diffuse;
-        } ) != matching_range.second;
+    bool found = false;
+    zg.for_each_at( candidate.pos, [&]( const mongroup &match ) {
+        // This is extra strict since we're using it to test serialization.
+        found = found || ( candidate.type == match.type && candidate.pos == match.pos &&
+            candidate.radius == match.radius &&
+            candidate.population == match.population &&
+            candidate.target == match.target &&
+            candidate.interest == match.interest &&
+            candidate.dying == match.dying &&
+            candidate.horde == match.horde &&
+            candidate.diffuse == match.diffuse );
+    } );
+    return found;
 }
 
 bool overmap::monster_check(const std::pair<tripoint, monster> &candidate) const
@@ -1944,18 +1946,13 @@ tripoint overmap::find_random_omt( const std::string &omt_base_type ) const
 
 void overmap::process_mongroups()
 {
-    for( auto it = zg.begin(); it != zg.end(); ) {
-        mongroup &mg = it->second;
+    zg.erase_if( []( mongroup &mg ) {
         if( mg.dying ) {
             mg.population = (mg.population * 4) / 5;
             mg.radius = (mg.radius * 9) / 10;
         }
-        if( mg.empty() ) {
-            zg.erase( it++ );
-        } else {
-            ++it;
-        }
-    }
+        return mg.empty();
+    } );
 }
 
 void overmap::clear_mon_groups()
@@ -1996,15 +1993,10 @@ void mongroup::wander( overmap &om )
 
 void overmap::move_hordes()
 {
-    // Prevent hordes to be moved twice by putting them in here after moving.
-    decltype(zg) tmpzg;
     //MOVE ZOMBIE GROUPS
-    for( auto it = zg.begin(); it != zg.end(); ) {
-        mongroup &mg = it->second;
-        if( !mg.horde ) {
-            ++it;
-            continue;
-        }
+    // Moving only touches the position index, so the horde list stays valid while we go.
+    for( const mongroup_store::handle h : zg.hordes() ) {
+        mongroup &mg = zg.get( h );
 
         if( mg.horde_behaviour.empty() ) {
             mg.horde_behaviour = one_in(2) ? "city" : "roam";
@@ -2031,31 +2023,24 @@ void overmap::move_hordes()
         if( one_in(movement_chance) && rng(0, 100) < mg.interest ) {
             // @todo: Adjust for monster speed.
             // @todo: Handle moving to adjacent overmaps.
-            if( mg.pos.x > mg.target.x) {
-                mg.pos.x--;
+            tripoint new_pos = mg.pos;
+            if( new_pos.x > mg.target.x) {
+                new_pos.x--;
             }
-            if( mg.pos.x < mg.target.x) {
-                mg.pos.x++;
+            if( new_pos.x < mg.target.x) {
+                new_pos.x++;
             }
-            if( mg.pos.y > mg.target.y) {
-                mg.pos.y--;
+            if( new_pos.y > mg.target.y) {
+                new_pos.y--;
             }
-            if( mg.pos.y < mg.target.y) {
-                mg.pos.y++;
+            if( new_pos.y < mg.target.y) {
+                new_pos.y++;
             }
-
-            // Erase the group at it's old location, add the group with the new location
-            tmpzg.insert( std::pair<tripoint, mongroup>( mg.pos, mg ) );
-            zg.erase( it++ );
-        } else {
-            ++it;
+            zg.move( h, new_pos );
         }
     }
-    // and now back into the monster group map.
-    zg.insert( tmpzg.begin(), tmpzg.end() );
 
-
-    if(get_option<bool>( "WANDER_SPAWNS" ) ) {
+    if(opt_wander_spawns.get() ) {
         static const mongroup_id GROUP_ZOMBIE("GROUP_ZOMBIE");
 
         // Re-absorb zombies into hordes.
@@ -2088,12 +2073,8 @@ void overmap::move_hordes()
 
             // Scan for compatible hordes in this area, selecting the largest.
             mongroup *add_to_group = NULL;
-            auto group_bucket = zg.equal_range(p);
             std::vector<monster>::size_type add_to_horde_size = 0;
-            std::for_each( group_bucket.first, group_bucket.second,
-                [&](std::pair<const tripoint, mongroup> &horde_entry ) {
-                mongroup &horde = horde_entry.second;
-
+            zg.for_each_at( p, [&]( mongroup &horde ) {
                 // We only absorb zombies into GROUP_ZOMBIE hordes
                 if(horde.horde && !horde.monsters.empty() && horde.type == GROUP_ZOMBIE && horde.monsters.size() > add_to_horde_size) {
                     add_to_group = &horde;
@@ -2131,11 +2112,8 @@ void overmap::move_hordes()
 */
 void overmap::signal_hordes( const tripoint &p, const int sig_power)
 {
-    for( auto &elem : zg ) {
-        mongroup &mg = elem.second;
-        if( !mg.horde ) {
-            continue;
-        }
+    for( const mongroup_store::handle h : zg.hordes() ) {
+        mongroup &mg = zg.get( h );
             const int dist = rl_dist( p, mg.pos );
             if( sig_power < dist ) {
                 continue;
@@ -3497,7 +3475,7 @@ void overmap::place_mongroups()
 {
     // Cities are full of zombies
     for( auto &elem : cities ) {
-        if( get_option<bool>( "WANDER_SPAWNS" ) ) {
+        if( opt_wander_spawns.get() ) {
             if( !one_in( 16 ) || elem.s > 5 ) {
                 mongroup m( mongroup_id( "GROUP_ZOMBIE" ), ( elem.x * 2 ), ( elem.y * 2 ), 0, int( elem.s * 2.5 ),
                             elem.s * 80 );
@@ -3737,7 +3715,7 @@ void overmap::add_mon_group(const mongroup &group)
     // makes the diffuse setting obsolete (as it only controls how the radius
     // is interpreted) - it's only used when adding monster groups with function.
     if( group.radius == 1 ) {
-        zg.insert(std::pair<tripoint, mongroup>( group.pos, group ) );
+        zg.insert( group );
         return;
     }
     // diffuse groups use a circular area, non-diffuse groups use a rectangular area
@@ -8,6 +8,7 @@
 #include "weighted_list.h"
 #include "game_constants.h"
 #include "monster.h"
+#include "mongroup.h"
 #include "weather_gen.h"
 
 #include <array>
@@ -30,7 +31,6 @@ namespace catacurses
 {
 class window;
 } // namespace catacurses
-struct mongroup;
 
 namespace pf
 {
@@ -341,7 +341,7 @@ class overmap
 
     void clear_mon_groups();
 private:
-    std::multimap<tripoint, mongroup> zg;
+    mongroup_store zg;
 public:
     /** Unit test enablers to check if a given mongroup is present. */
     bool mongroup_check(const mongroup &candidate) const;
@@ -95,18 +95,15 @@ void overmapbuffer::create_custom_overmap( int const x, int const y, overmap_spe
 
 void overmapbuffer::fix_mongroups(overmap &new_overmap)
 {
-    for( auto it = new_overmap.zg.begin(); it != new_overmap.zg.end(); ) {
-        auto &mg = it->second;
+    new_overmap.zg.erase_if( [&]( const mongroup &mg ) {
         // spawn related code simply sets population to 0 when they have been
         // transformed into spawn points on a submap, the group can then be removed
         if( mg.empty() ) {
-            new_overmap.zg.erase( it++ );
-            continue;
+            return true;
         }
         // Inside the bounds of the overmap?
         if( mg.pos.x >= 0 && mg.pos.y >= 0 && mg.pos.x < OMAPX * 2 && mg.pos.y < OMAPY * 2 ) {
-            ++it;
-            continue;
+            return false;
         }
         point smabs( mg.pos.x + new_overmap.pos().x * OMAPX * 2,
                      mg.pos.y + new_overmap.pos().y * OMAPY * 2 );
@@ -114,15 +111,15 @@ void overmapbuffer::fix_mongroups(overmap &new_overmap)
         if( !has( omp.x, omp.y ) ) {
             // Don't generate new overmaps, as this can be called from the
             // overmap-generating code.
-            ++it;
-            continue;
+            return false;
         }
         overmap &om = get( omp.x, omp.y );
-        mg.pos.x = smabs.x;
-        mg.pos.y = smabs.y;
-        om.add_mon_group( mg );
-        new_overmap.zg.erase( it++ );
-    }
+        mongroup moved = mg;
+        moved.pos.x = smabs.x;
+        moved.pos.y = smabs.y;
+        om.add_mon_group( moved );
+        return true;
+    } );
 }
 
 void overmapbuffer::fix_npcs( overmap &new_overmap )
@@ -436,13 +433,11 @@ std::vector<mongroup*> overmapbuffer::groups_at(int x, int y, int z)
     }
     const tripoint dpos( x, y, z );
     overmap &om = get( omp.x, omp.y );
-    for( auto it = om.zg.lower_bound( dpos ), end = om.zg.upper_bound( dpos ); it != end; ++it ) {
-        auto &mg = it->second;
-        if( mg.empty() ) {
-            continue;
+    om.zg.for_each_at( dpos, [&result]( mongroup &mg ) {
+        if( !mg.empty() ) {
+            result.push_back( &mg );
         }
-        result.push_back( &mg );
-    }
+    } );
     return result;
 }
 
@@ -4,6 +4,7 @@
 #include "coordinate_conversions.h"
 #include "profession.h"
 #include "itype.h"
+#include "visitable_inline.h"
 #include "string_formatter.h"
 #include "bionics.h"
 #include "mapdata.h"
@@ -419,6 +420,10 @@ static const trait_id trait_WHISKERS_RAT( "WHISKERS_RAT" );
 static const trait_id trait_WINGS_BUTTERFLY( "WINGS_BUTTERFLY" );
 static const trait_id trait_WOOLALLERGY( "WOOLALLERGY" );
 
+static const interned_flag flag_COLLAR( "COLLAR" );
+static const interned_flag flag_HOOD( "HOOD" );
+static const interned_flag flag_POCKETS( "POCKETS" );
+
 static const itype_id OPTICAL_CLOAK_ITEM_ID( "optical_cloak" );
 
 stat_mod player::get_pain_penalty() const
@@ -713,8 +718,8 @@ void player::reset_stats()
     }
 
     // Effects
-    for( auto maps : *effects ) {
-        for( auto i : maps.second ) {
+    for( const auto &maps : *effects ) {
+        for( const auto &i : maps.second ) {
             const auto &it = i.second;
             bool reduced = resists_effect( it );
             mod_str_bonus( it.get_mod( "STR", reduced ) );
@@ -746,7 +751,7 @@ void player::process_turn()
         charge_power( 25 );
     }
 
-    visit_items( [this]( item * e ) {
+    visit_items_inline( [this]( item * e, item * ) {
         e->process_artifact( this, pos() );
         return VisitResponse::NEXT;
     } );
@@ -1035,32 +1040,10 @@ void player::update_bodytemp()
     // Fire at our tile
     const int fire_warmth = bodytemp_modifier_fire();
 
-    // Cache fires to avoid scanning the map around us bp times
-    // Stored as intensity-distance pairs
-    std::vector<std::pair<int, int>> fires;
-    fires.reserve( 13 * 13 );
-    int best_fire = 0;
-    for( const tripoint &dest : g->m.points_in_radius( pos(), 6 ) ) {
-        int heat_intensity = 0;
-
-        int ffire = g->m.get_field_strength( dest, fd_fire );
-        if( ffire > 0 ) {
-            heat_intensity = ffire;
-        } else if( g->m.tr_at( dest ).loadid == tr_lava ) {
-            heat_intensity = 3;
-        }
-        if( heat_intensity == 0 || !g->m.sees( pos(), dest, -1 ) ) {
-            // No heat source here
-            continue;
-        }
-        // Ensure fire_dist >= 1 to avoid divide-by-zero errors.
-        const int fire_dist = std::max( 1, square_dist( dest, pos() ) );
-        fires.emplace_back( std::make_pair( heat_intensity, fire_dist ) );
-        if( fire_dist <= 1 ) {
-            // Extend limbs/lean over a single adjacent fire to warm up
-            best_fire = std::max( best_fire, heat_intensity );
-        }
-    }
+    // Fires and lava in sight, stored as intensity-distance pairs
+    const radiant_heat &heat = g->m.radiant_heat_at( pos() );
+    const std::vector<std::pair<int, int>> &fires = heat.sources;
+    const int best_fire = heat.adjacent;
 
     const int lying_warmth = use_floor_warmth ? floor_warmth( pos() ) : 0;
     const int water_temperature =
@@ -1762,8 +1745,8 @@ void player::recalc_speed_bonus()
         mod_speed_bonus( hunger_speed_penalty( get_hunger() + get_starvation() ) );
     }
 
-    for( auto maps : *effects ) {
-        for( auto i : maps.second ) {
+    for( const auto &maps : *effects ) {
+        for( const auto &i : maps.second ) {
             bool reduced = resists_effect( i.second );
             mod_speed_bonus( i.second.get_mod( "SPEED", reduced ) );
         }
@@ -6562,6 +6545,11 @@ void player::process_active_items()
 
     std::vector<item *> inv_active = inv.active_items();
     for( auto tmp_it : inv_active ) {
+        // Food that only rots is processed as rarely as it would be on the map.
+        if( tmp_it->only_rots() &&
+            !calendar::once_every( time_duration::from_turns( tmp_it->processing_speed() ) ) ) {
+            continue;
+        }
 
         if( tmp_it->process( this, pos(), false ) ) {
             inv.remove_item(tmp_it);
@@ -6570,7 +6558,16 @@ void player::process_active_items()
 
     // worn items
     remove_worn_items_with( [this]( item &itm ) {
-        return itm.needs_processing() && itm.process( this, pos(), false );
+        if( !itm.needs_processing() ) {
+            return false;
+        }
+        // Tools switch themselves off when they run out of charges
+        const itype *const old_type = itm.type;
+        const bool destroyed = itm.process( this, pos(), false );
+        if( itm.type != old_type ) {
+            set_worn_summary_dirty();
+        }
+        return destroyed;
     } );
 
     long ch_UPS = charges_of( "UPS" );
@@ -10027,25 +10024,18 @@ int player::get_wind_resistance(body_part bp) const
 
 int player::warmth(body_part bp) const
 {
-    int ret = 0;
-    int warmth = 0;
-
-    for (auto &i : worn) {
-        if( i.covers( bp ) ) {
-            warmth = i.get_warmth();
-            // Wool items do not lose their warmth due to being wet.
-            // Warmth is reduced by 0 - 66% based on wetness.
-            if (!i.made_of( material_id( "wool" ) ))
-            {
-                warmth *= 1.0 - 0.66 * body_wetness[bp] / drench_capacity[bp];
-            }
-            ret += warmth;
-        }
+    const worn_summary &summary = get_worn_summary();
+    // Wool items do not lose their warmth due to being wet.
+    int ret = summary.wool_warmth[bp];
+    // Warmth is reduced by 0 - 66% based on wetness.
+    const double wet_factor = 1.0 - 0.66 * body_wetness[bp] / drench_capacity[bp];
+    for( const int warmth : summary.wettable_warmth[bp] ) {
+        ret += int( warmth * wet_factor );
     }
     return ret;
 }
 
-int bestwarmth( const std::list< item > &its, const std::string &flag )
+int bestwarmth( const std::list< item > &its, const interned_flag &flag )
 {
     int best = 0;
     for( auto &w : its ) {
@@ -10062,17 +10052,17 @@ int player::bonus_item_warmth(body_part bp) const
 
     // If the player is not wielding anything big, check if hands can be put in pockets
     if( ( bp == bp_hand_l || bp == bp_hand_r ) && weapon.volume() < 500_ml ) {
-        ret += bestwarmth( worn, "POCKETS" );
+        ret += bestwarmth( worn, flag_POCKETS );
     }
 
     // If the player's head is not encumbered, check if hood can be put up
     if( bp == bp_head && encumb( bp_head ) < 10 ) {
-        ret += bestwarmth( worn, "HOOD" );
+        ret += bestwarmth( worn, flag_HOOD );
     }
 
     // If the player's mouth is not encumbered, check if collar can be put up
     if( bp == bp_mouth && encumb( bp_mouth ) < 10 ) {
-        ret += bestwarmth( worn, "COLLAR" );
+        ret += bestwarmth( worn, flag_COLLAR );
     }
 
     return ret;
@@ -10445,11 +10435,7 @@ int player::get_env_resist(body_part bp) const
 
 bool player::wearing_something_on(body_part bp) const
 {
-    for (auto &i : worn) {
-        if (i.covers(bp))
-            return true;
-    }
-    return false;
+    return get_worn_summary().covered.test( bp );
 }
 
 
@@ -10465,44 +10451,15 @@ bool player::natural_attack_restricted_on( body_part bp ) const
 
 bool player::is_wearing_shoes( const side &which_side ) const
 {
-    bool left = true;
-    bool right = true;
-    if( which_side == side::LEFT || which_side == side::BOTH ) {
-        left = false;
-        for( const item &worn_item : worn ) {
-            if (worn_item.covers(bp_foot_l) &&
-                !worn_item.has_flag("BELTED") &&
-                !worn_item.has_flag("SKINTIGHT")) {
-                left = true;
-                break;
-            }
-        }
-    }
-    if( which_side == side::RIGHT || which_side == side::BOTH ) {
-        right = false;
-        for( const item &worn_item : worn ) {
-            if (worn_item.covers(bp_foot_r) &&
-                !worn_item.has_flag("BELTED") &&
-                !worn_item.has_flag("SKINTIGHT")) {
-                right = true;
-                break;
-            }
-        }
-    }
+    const worn_summary &summary = get_worn_summary();
+    const bool left = which_side == side::RIGHT || summary.shoe_left;
+    const bool right = which_side == side::LEFT || summary.shoe_right;
     return (left && right);
 }
 
 bool player::is_wearing_helmet() const
 {
-    for( auto i : worn ) {
-        if( i.covers( bp_head ) &&
-            !i.has_flag( "HELMET_COMPAT" ) &&
-            !i.has_flag( "SKINTIGHT" ) &&
-            !i.has_flag( "OVERSIZE" ) ) {
-            return true;
-        }
-    }
-    return false;
+    return get_worn_summary().helmet;
 }
 
 int player::head_cloth_encumbrance() const
@@ -10543,23 +10500,11 @@ int player::shoe_type_count(const itype_id & it) const
 }
 
 bool player::is_wearing_power_armor(bool *hasHelmet) const {
-    bool result = false;
-    for( auto &elem : worn ) {
-        if( !elem.is_power_armor() ) {
-            continue;
-        }
-        if (hasHelmet == nullptr) {
-            // found power armor, helmet not requested, cancel loop
-            return true;
-        }
-        // found power armor, continue search for helmet
-        result = true;
-        if( elem.covers( bp_head ) ) {
-            *hasHelmet = true;
-            return true;
-        }
+    const worn_summary &summary = get_worn_summary();
+    if( hasHelmet != nullptr && summary.power_armor_helmet ) {
+        *hasHelmet = true;
     }
-    return result;
+    return summary.power_armor;
 }
 
 int player::adjust_for_focus(int amount) const
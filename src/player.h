@@ -20,6 +20,7 @@ static const std::string DEFAULT_HOTKEYS("1234567890abcdefghijklmnopqrstuvwxyz")
 
 class craft_command;
 class recipe_subset;
+class recipe_availability;
 enum action_id : int;
 struct bionic;
 class JsonObject;
@@ -1291,6 +1292,8 @@ class player : public Character
         // yet more crafting.cpp
         const inventory &crafting_inventory(); // includes nearby items
         void invalidate_crafting_inventory();
+        /** Availability of recipes with the current @ref crafting_inventory, updated incrementally */
+        recipe_availability &get_recipe_availability();
         comp_selection<item_comp>
             select_item_component( const std::vector<item_comp> &components,
                                    int batch, inventory &map_inv, bool can_cancel = false );
@@ -1716,6 +1719,9 @@ class player : public Character
         /** Subset of learned recipes. Needs to be mutable for lazy initialization. */
         mutable pimpl<recipe_subset> learned_recipes;
 
+        /** Availability of recipes, kept between crafting menus to re-check only what changed. */
+        pimpl<recipe_availability> recipe_avail;
+
         /** Stamp of skills. @ref learned_recipes are valid only with this set of skills. */
         mutable decltype( _skills ) valid_autolearn_skills;
 
@@ -0,0 +1,233 @@
+#include "profiler.h"
+
+#include "json.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+// Trivially initialised, so operator new can use it at any time.
+static thread_local unsigned long long thread_allocations = 0;
+
+#if defined(CATA_PROFILE_ALLOCATIONS) && !defined(CATA_NO_PROFILER)
+void *operator new( std::size_t size )
+{
+    thread_allocations++;
+    if( size == 0 ) {
+        size = 1;
+    }
+    while( true ) {
+        if( void *const ptr = std::malloc( size ) ) {
+            return ptr;
+        }
+        const std::new_handler handler = std::get_new_handler();
+        if( handler == nullptr ) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void operator delete( void *ptr ) noexcept
+{
+    std::free( ptr );
+}
+#endif
+
+namespace profiler
+{
+
+std::atomic<bool> active( false );
+
+namespace
+{
+
+// Each thread keeps this many finished zones for the Chrome trace.
+constexpr size_t ring_size = 1 << 16;
+
+const clock::time_point trace_origin = clock::now();
+
+struct zone_event {
+    const char *name;
+    clock::time_point start;
+    clock::duration duration;
+};
+
+struct tree_node {
+    const char *name;
+    int parent;
+    int depth;
+    int calls;
+    clock::duration time;
+    long allocations;
+    std::vector<int> children;
+};
+
+struct thread_data {
+    int id;
+    std::vector<zone_event> ring;
+    // Oldest event once the ring is full.
+    size_t ring_next = 0;
+    // Node 0 is the root, the zones of the thread are below it.
+    std::vector<tree_node> tree;
+    int current = 0;
+
+    thread_data();
+    ~thread_data();
+
+    void record( const zone_event &event ) {
+        if( ring.size() < ring_size ) {
+            ring.push_back( event );
+        } else {
+            ring[ring_next] = event;
+            ring_next = ( ring_next + 1 ) % ring_size;
+        }
+    }
+};
+
+std::mutex threads_mutex;
+std::vector<thread_data *> threads;
+int next_thread_id = 0;
+
+std::vector<zone_stats> last_turn_stats;
+
+thread_data::thread_data()
+{
+    tree.push_back( tree_node{ "", -1, -1, 0, clock::duration::zero(), 0, {} } );
+    std::lock_guard<std::mutex> lock( threads_mutex );
+    id = next_thread_id++;
+    threads.push_back( this );
+}
+
+thread_data::~thread_data()
+{
+    std::lock_guard<std::mutex> lock( threads_mutex );
+    threads.erase( std::remove( threads.begin(), threads.end(), this ), threads.end() );
+}
+
+thread_data &this_thread()
+{
+    static thread_local thread_data data;
+    return data;
+}
+
+void collect( thread_data &t, const int index )
+{
+    tree_node &node = t.tree[index];
+    if( node.calls > 0 ) {
+        const std::chrono::duration<double, std::milli> ms = node.time;
+        last_turn_stats.push_back( zone_stats{ node.name, node.depth, node.calls, ms.count(), node.allocations } );
+        node.calls = 0;
+        node.time = clock::duration::zero();
+        node.allocations = 0;
+    }
+    for( const int child : node.children ) {
+        collect( t, child );
+    }
+}
+
+double to_microseconds( const clock::duration &d )
+{
+    return std::chrono::duration<double, std::micro>( d ).count();
+}
+
+}
+
+void set_enabled( const bool enable )
+{
+    active.store( enable, std::memory_order_relaxed );
+}
+
+void next_turn()
+{
+    // The tree itself is kept so zones that are still open stay valid.
+    last_turn_stats.clear();
+    collect( this_thread(), 0 );
+}
+
+unsigned long long allocation_count()
+{
+    return thread_allocations;
+}
+
+const std::vector<zone_stats> &last_turn()
+{
+    return last_turn_stats;
+}
+
+void clear()
+{
+    std::lock_guard<std::mutex> lock( threads_mutex );
+    for( thread_data *t : threads ) {
+        t->ring.clear();
+        t->ring_next = 0;
+        for( tree_node &node : t->tree ) {
+            node.calls = 0;
+            node.time = clock::duration::zero();
+            node.allocations = 0;
+        }
+    }
+    last_turn_stats.clear();
+}
+
+void write_chrome_trace( JsonOut &json )
+{
+    json.start_object();
+    json.member( "traceEvents" );
+    json.start_array();
+    std::lock_guard<std::mutex> lock( threads_mutex );
+    for( const thread_data *t : threads ) {
+        for( size_t i = 0; i < t->ring.size(); i++ ) {
+            const zone_event &event = t->ring[( t->ring_next + i ) % t->ring.size()];
+            json.start_object();
+            json.member( "name", std::string( event.name ) );
+            json.member( "ph", std::string( "X" ) );
+            json.member( "ts", to_microseconds( event.start - trace_origin ) );
+            json.member( "dur", to_microseconds( event.duration ) );
+            json.member( "pid", 1 );
+            json.member( "tid", t->id );
+            json.end_object();
+        }
+    }
+    json.end_array();
+    json.member( "displayTimeUnit", std::string( "ms" ) );
+    json.end_object();
+}
+
+void scoped_zone::begin( const char *name )
+{
+    thread_data &t = this_thread();
+    int found = -1;
+    for( const int child : t.tree[t.current].children ) {
+        if( t.tree[child].name == name || std::strcmp( t.tree[child].name, name ) == 0 ) {
+            found = child;
+            break;
+        }
+    }
+    if( found < 0 ) {
+        found = t.tree.size();
+        const int depth = t.tree[t.current].depth + 1;
+        t.tree.push_back( tree_node{ name, t.current, depth, 0, clock::duration::zero(), 0, {} } );
+        t.tree[t.current].children.push_back( found );
+    }
+    t.current = found;
+    started = true;
+    start_allocations = thread_allocations;
+    start = clock::now();
+}
+
+void scoped_zone::end()
+{
+    const clock::duration duration = clock::now() - start;
+    thread_data &t = this_thread();
+    tree_node &node = t.tree[t.current];
+    node.calls++;
+    node.time += duration;
+    node.allocations += thread_allocations - start_allocations;
+    t.record( zone_event{ node.name, start, duration } );
+    t.current = node.parent;
+}
+
+}
@@ -0,0 +1,105 @@
+#pragma once
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+class JsonOut;
+
+/**
+ * Scoped-zone profiler for the main loop.
+ *
+ * Mark a block with @ref CATA_PROFILE_ZONE to time it while profiling is enabled. Each
+ * thread keeps the zones it finished in a ring buffer (for @ref write_chrome_trace) and
+ * the call tree of the current turn (for @ref last_turn). When profiling is disabled a
+ * zone costs one relaxed atomic load; building with CATA_NO_PROFILER removes zones
+ * entirely.
+ *
+ * Building with CATA_PROFILE_ALLOCATIONS replaces the global operator new by one that
+ * counts allocations per thread, so zones also report the allocation churn inside them.
+ * Otherwise allocations are not counted and always reported as 0.
+ */
+namespace profiler
+{
+
+using clock = std::chrono::steady_clock;
+
+/** Time spent in one node of the zone tree during the last finished turn. */
+struct zone_stats {
+    /** Zone name, e.g. "monmove". */
+    const char *name;
+    /** Nesting depth, 0 for the outermost zones. */
+    int depth;
+    int calls;
+    double ms;
+    /** Heap allocations (operator new) made inside the zone. */
+    long allocations;
+};
+
+extern std::atomic<bool> active;
+
+inline bool enabled()
+{
+    return active.load( std::memory_order_relaxed );
+}
+void set_enabled( bool enable );
+
+/**
+ * Finishes the turn of the calling thread: its zone tree becomes the one returned by
+ * @ref last_turn and a new, empty one is started. Called at the start of game::do_turn.
+ */
+void next_turn();
+/** Zone tree of the last turn of the main thread, in depth-first order. */
+const std::vector<zone_stats> &last_turn();
+/** Forgets all recorded zones. */
+void clear();
+
+/** Number of heap allocations made by the calling thread so far, 0 unless they are counted. */
+unsigned long long allocation_count();
+
+/**
+ * Writes the ring buffers of all threads as a Chrome trace (chrome://tracing,
+ * about://tracing or Perfetto can open it).
+ */
+void write_chrome_trace( JsonOut &json );
+
+class scoped_zone
+{
+    public:
+        explicit scoped_zone( const char *name ) {
+            if( enabled() ) {
+                begin( name );
+            }
+        }
+        ~scoped_zone() {
+            if( started ) {
+                end();
+            }
+        }
+        scoped_zone( const scoped_zone & ) = delete;
+        scoped_zone &operator=( const scoped_zone & ) = delete;
+
+    private:
+        void begin( const char *name );
+        void end();
+
+        bool started = false;
+        clock::time_point start;
+        unsigned long long start_allocations = 0;
+};
+
+}
+
+#ifdef CATA_NO_PROFILER
+#define CATA_PROFILE_ZONE( name )
+#else
+#define CATA_PROFILE_ZONE_CONCAT_( a, b ) a##b
+#define CATA_PROFILE_ZONE_VAR_( line ) CATA_PROFILE_ZONE_CONCAT_( profile_zone_, line )
+/** Times the rest of the enclosing block as a zone named @p name (a string literal). */
+#define CATA_PROFILE_ZONE( name ) profiler::scoped_zone CATA_PROFILE_ZONE_VAR_( __LINE__ )( name )
+#endif
+
+#endif
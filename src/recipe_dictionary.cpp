@@ -8,6 +8,8 @@
 #include "cata_utility.h"
 #include "crafting.h"
 #include "skill.h"
+#include "inventory.h"
+#include "player.h"
 
 #include <algorithm>
 #include <numeric>
@@ -61,61 +63,92 @@ const recipe &recipe_dictionary::get_uncraft( const itype_id &id )
     return iter != recipe_dict.uncraft.end() ? iter->second : null_recipe;
 }
 
-// searches for left-anchored partial match in the relevant recipe requirements set
+static const trait_id trait_DEBUG_HS( "DEBUG_HS" );
+
+/** Lower-cased searchable text of every recipe, built on first search of each type */
+static std::map<recipe_subset::search_type, std::map<const recipe *, std::string>> search_index;
+
+static std::string lowercase( const std::string &str )
+{
+    std::string res;
+    res.reserve( str.size() );
+    std::transform( str.begin(), str.end(), std::back_inserter( res ), tolower );
+    return res;
+}
+
+// Matched entries are separated with a newline which can't be part of a query,
+// so a match in the joined text is a match in one of the entries.
 template <class group>
-bool search_reqs( group gp, const std::string &txt )
+static std::string join_reqs( const group &gp )
 {
-    return std::any_of( gp.begin(), gp.end(), [&]( const typename group::value_type & opts ) {
-        return std::any_of( opts.begin(),
-        opts.end(), [&]( const typename group::value_type::value_type & e ) {
-            return lcmatch( e.to_string(), txt );
-        } );
-    } );
+    std::string res;
+    for( const auto &opts : gp ) {
+        for( const auto &e : opts ) {
+            res += e.to_string();
+            res += '\n';
+        }
+    }
+    return res;
 }
 // template specialization to make component searches easier
 template<>
-bool search_reqs( std::vector<std::vector<item_comp> >  gp,
-                  const std::string &txt )
+std::string join_reqs( const std::vector<std::vector<item_comp> > &gp )
 {
-    return std::any_of( gp.begin(), gp.end(), [&]( const std::vector<item_comp> &opts ) {
-        return std::any_of( opts.begin(), opts.end(), [&]( const item_comp & ic ) {
-            return lcmatch( item::nname( ic.type ), txt );
-        } );
-    } );
+    std::string res;
+    for( const auto &opts : gp ) {
+        for( const item_comp &ic : opts ) {
+            res += item::nname( ic.type );
+            res += '\n';
+        }
+    }
+    return res;
 }
 
-std::vector<const recipe *> recipe_subset::search( const std::string &txt,
-        const search_type key ) const
+static std::string search_text( const recipe &r, const recipe_subset::search_type key )
 {
-    std::vector<const recipe *> res;
+    switch( key ) {
+        case recipe_subset::search_type::name:
+            return r.result_name();
 
-    std::copy_if( recipes.begin(), recipes.end(), std::back_inserter( res ), [&]( const recipe * r ) {
-        switch( key ) {
-            case search_type::name:
-                return lcmatch( r->result_name(), txt );
+        case recipe_subset::search_type::skill:
+            return r.required_skills_string() + '\n' + r.skill_used->name();
 
-            case search_type::skill:
-                return lcmatch( r->required_skills_string(), txt ) || lcmatch( r->skill_used->name(), txt );
+        case recipe_subset::search_type::component:
+            return join_reqs( r.requirements().get_components() );
 
-            case search_type::component:
-                return search_reqs( r->requirements().get_components(), txt );
+        case recipe_subset::search_type::tool:
+            return join_reqs( r.requirements().get_tools() );
 
-            case search_type::tool:
-                return search_reqs( r->requirements().get_tools(), txt );
+        case recipe_subset::search_type::quality:
+            return join_reqs( r.requirements().get_qualities() );
 
-            case search_type::quality:
-                return search_reqs( r->requirements().get_qualities(), txt );
-
-            case search_type::quality_result: {
-                const auto &quals = item::find_type( r->result() )->qualities;
-                return std::any_of( quals.begin(), quals.end(), [&]( const std::pair<quality_id, int> &e ) {
-                    return lcmatch( e.first->name, txt );
-                } );
+        case recipe_subset::search_type::quality_result: {
+            std::string res;
+            for( const auto &e : item::find_type( r.result() )->qualities ) {
+                res += e.first->name;
+                res += '\n';
             }
+            return res;
+        }
+
+        default:
+            return std::string();
+    }
+}
 
-            default:
-                return false;
+std::vector<const recipe *> recipe_subset::search( const std::string &txt,
+        const search_type key ) const
+{
+    std::vector<const recipe *> res;
+    const std::string needle = lowercase( txt );
+    auto &index = search_index[key];
+
+    std::copy_if( recipes.begin(), recipes.end(), std::back_inserter( res ), [&]( const recipe * r ) {
+        auto iter = index.find( r );
+        if( iter == index.end() ) {
+            iter = index.emplace( r, lowercase( search_text( *r, key ) ) ).first;
         }
+        return iter->second.find( needle ) != std::string::npos;
     } );
 
     return res;
@@ -286,11 +319,17 @@ void recipe_dictionary::finalize()
 
 void recipe_dictionary::reset()
 {
+    reset_search_index();
     recipe_dict.autolearn.clear();
     recipe_dict.recipes.clear();
     recipe_dict.uncraft.clear();
 }
 
+void recipe_dictionary::reset_search_index()
+{
+    search_index.clear();
+}
+
 void recipe_dictionary::delete_if( const std::function<bool( const recipe & )> &pred )
 {
     ::delete_if( recipe_dict.recipes, pred );
@@ -347,3 +386,104 @@ int recipe_subset::get_custom_difficulty( const recipe *r ) const
     }
     return r->difficulty;
 }
+
+void recipe_availability::update( const player &p, const inventory &crafting_inv )
+{
+    inv = &crafting_inv;
+
+    const bool hs = p.has_trait( trait_DEBUG_HS );
+    if( hs != debug_hs ) {
+        debug_hs = hs;
+        cache.clear();
+    }
+
+    std::map<itype_id, type_summary> current;
+    crafting_inv.visit_items( [&current]( const item * e ) {
+        auto &entry = current[ e->typeId() ];
+        entry.count++;
+        entry.charges += std::max( e->charges, 0L );
+        entry.damage += e->damage();
+        entry.filled += !e->contents.empty();
+        return VisitResponse::NEXT;
+    } );
+    // tools consuming charges may be powered by any UPS
+    current[ "UPS" ].charges = crafting_inv.charges_of( "UPS" );
+
+    for( const auto &e : summary ) {
+        const auto iter = current.find( e.first );
+        if( iter == current.end() || iter->second != e.second ) {
+            invalidate( e.first );
+        }
+    }
+    for( const auto &e : current ) {
+        if( !summary.count( e.first ) ) {
+            invalidate( e.first );
+        }
+    }
+    summary = std::move( current );
+}
+
+bool recipe_availability::can_make( const recipe *r )
+{
+    auto iter = cache.find( r );
+    if( iter == cache.end() ) {
+        index( r );
+        iter = cache.emplace( r, r->requirements().can_make_with_inventory( *inv ) ).first;
+    }
+    return iter->second;
+}
+
+void recipe_availability::clear()
+{
+    inv = nullptr;
+    summary.clear();
+    cache.clear();
+    by_type.clear();
+    by_quality.clear();
+}
+
+void recipe_availability::index( const recipe *r )
+{
+    const requirement_data &req = r->requirements();
+    for( const auto &opts : req.get_components() ) {
+        for( const item_comp &comp : opts ) {
+            by_type[ comp.type ].insert( r );
+        }
+    }
+    for( const auto &opts : req.get_tools() ) {
+        for( const tool_comp &tool : opts ) {
+            by_type[ tool.type ].insert( r );
+            if( tool.by_charges() ) {
+                by_type[ "UPS" ].insert( r );
+            }
+        }
+    }
+    for( const auto &opts : req.get_qualities() ) {
+        for( const quality_requirement &qual : opts ) {
+            by_quality[ qual.type ].insert( r );
+        }
+    }
+}
+
+void recipe_availability::invalidate( const itype_id &id )
+{
+    const auto drop = [this]( const std::set<const recipe *> &dependent ) {
+        for( const recipe *r : dependent ) {
+            cache.erase( r );
+        }
+    };
+
+    const auto iter = by_type.find( id );
+    if( iter != by_type.end() ) {
+        drop( iter->second );
+    }
+    if( !item::type_is_defined( id ) ) {
+        return;
+    }
+    for( const auto &qual : item::find_type( id )->qualities ) {
+        const auto q = by_quality.find( qual.first );
+        if( q != by_quality.end() ) {
+            drop( q->second );
+        }
+    }
+}
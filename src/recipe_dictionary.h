@@ -15,9 +15,13 @@
 class JsonIn;
 class JsonOut;
 class JsonObject;
+class inventory;
+class player;
 typedef std::string itype_id;
 class recipe;
 using recipe_id = string_id<recipe>;
+struct quality;
+using quality_id = string_id<quality>;
 
 class recipe_dictionary
 {
@@ -42,6 +46,8 @@ class recipe_dictionary
 
         static void finalize();
         static void reset();
+        /** Forgets the searchable recipe texts, they are translated */
+        static void reset_search_index();
 
     protected:
         /**
@@ -151,6 +157,55 @@ class recipe_subset
         std::map<itype_id, std::set<const recipe *>> component;
 };
 
+/**
+ * Caches whether recipes can be made with a crafting inventory.
+ *
+ * Each evaluated recipe is indexed by the item types and tool qualities it depends upon.
+ * On @ref update the inventory is summarized per item type and only the recipes depending
+ * on types whose summary changed are invalidated, to be re-evaluated on next request.
+ */
+class recipe_availability
+{
+    public:
+        /**
+         * Set the crafter and the inventory used for further queries.
+         * Recipes depending on items that changed since the previous call are invalidated.
+         * @warning The inventory must outlive any subsequent call to @ref can_make.
+         */
+        void update( const player &p, const inventory &crafting_inv );
+
+        /** Whether the recipe can be made (single batch) with the current inventory */
+        bool can_make( const recipe *r );
+
+        void clear();
+
+    private:
+        struct type_summary {
+            long count = 0;
+            long charges = 0;
+            int damage = 0;
+            int filled = 0;
+
+            bool operator==( const type_summary &rhs ) const {
+                return count == rhs.count && charges == rhs.charges &&
+                       damage == rhs.damage && filled == rhs.filled;
+            }
+            bool operator!=( const type_summary &rhs ) const {
+                return !operator==( rhs );
+            }
+        };
+
+        void index( const recipe *r );
+        void invalidate( const itype_id &id );
+
+        const inventory *inv = nullptr;
+        bool debug_hs = false;
+        std::map<itype_id, type_summary> summary;
+        std::map<const recipe *, bool> cache;
+        std::map<itype_id, std::set<const recipe *>> by_type;
+        std::map<quality_id, std::set<const recipe *>> by_quality;
+};
+
 void serialize( const recipe_subset &value, JsonOut &jsout );
 void deserialize( recipe_subset &value, JsonIn &jsin );
 
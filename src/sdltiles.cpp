@@ -385,12 +385,12 @@ bool WinCreate()
     // Initialize framebuffer caches
     terminal_framebuffer.resize(TERMINAL_HEIGHT);
     for (int i = 0; i < TERMINAL_HEIGHT; i++) {
-        terminal_framebuffer[i].chars.assign(TERMINAL_WIDTH, cursecell(""));
+        terminal_framebuffer[i].chars.assign(TERMINAL_WIDTH, cursecell( "" ));
     }
 
     oversized_framebuffer.resize(TERMINAL_HEIGHT);
     for (int i = 0; i < TERMINAL_HEIGHT; i++) {
-        oversized_framebuffer[i].chars.assign(TERMINAL_WIDTH, cursecell(""));
+        oversized_framebuffer[i].chars.assign(TERMINAL_WIDTH, cursecell( "" ));
     }
 
     const Uint32 wformat = SDL_GetWindowPixelFormat( ::window.get() );
@@ -1048,7 +1048,10 @@ bool Font::draw_window( const catacurses::window &w, const int offsetx, const in
     }
 
     // @todo: Get this from UTF system to make sure it is exactly the kind of space we need
-    static const std::string space_string = " ";
+    static const char *const space_string = " ";
+
+    std::vector<curseline> &framebuffer = use_oversized_framebuffer ? oversized_framebuffer :
+                                          terminal_framebuffer;
 
     bool update = false;
     for( int j = 0; j < win->height; j++ ) {
@@ -1057,6 +1060,16 @@ bool Font::draw_window( const catacurses::window &w, const int offsetx, const in
         }
         update = true;
         win->line[j].touched = false;
+
+        // Most touched lines are rewritten with the same content, compare the whole
+        // visible row against the framebuffer at once before going cell by cell.
+        const int fby = win->y + j;
+        if( oldWinCompatible && fontScale == fontScaleBuffer && win->width > 0 &&
+            fby < static_cast<int>( framebuffer.size() ) &&
+            win->x + win->width <= static_cast<int>( framebuffer[fby].chars.size() ) &&
+            cata_cursesport::same_cells( &win->line[j].chars[0], &framebuffer[fby].chars[win->x], win->width ) ) {
+            continue;
+        }
         for( int i = 0; i < win->width; i++ ) {
             const cursecell &cell = win->line[j].chars[i];
 
@@ -1070,10 +1083,6 @@ bool Font::draw_window( const catacurses::window &w, const int offsetx, const in
             // Avoid redrawing an unchanged tile by checking the framebuffer cache
             // TODO: handle caching when drawing normal windows over graphical tiles
             const int fbx = win->x + i;
-            const int fby = win->y + j;
-
-            std::vector<curseline> &framebuffer = use_oversized_framebuffer ? oversized_framebuffer :
-                                             terminal_framebuffer;
 
             cursecell &oldcell = framebuffer[fby].chars[fbx];
 
@@ -1091,20 +1100,21 @@ bool Font::draw_window( const catacurses::window &w, const int offsetx, const in
                 FillRectDIB( drawx, drawy, fontwidth, fontheight, cell.BG );
                 continue;
             }
-            const char *utf8str = cell.ch.c_str();
-            int len = cell.ch.length();
+            const std::string ch = cell.ch.str();
+            const char *utf8str = ch.c_str();
+            int len = ch.length();
             const int codepoint = UTF8_getch( &utf8str, &len );
             const catacurses::base_color FG = cell.FG;
             const catacurses::base_color BG = cell.BG;
             const cata_cursesport::font_style FS = cell.FS;
             if( codepoint != UNKNOWN_UNICODE ) {
-                const int cw = utf8_width( cell.ch );
+                const int cw = utf8_width( ch );
                 if( cw < 1 ) {
                     // utf8_width() may return a negative width
                     continue;
                 }
                 FillRectDIB( drawx, drawy, fontwidth * cw, fontheight, BG );
-                OutputChar( cell.ch, drawx, drawy, FG, FS );
+                OutputChar( ch, drawx, drawy, FG, FS );
             } else {
                 FillRectDIB( drawx, drawy, fontwidth, fontheight, BG );
                 draw_ascii_lines( static_cast<unsigned char>( cell.ch[0] ), drawx, drawy, FG, FS );
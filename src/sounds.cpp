@@ -24,9 +24,13 @@
 #include "mapdata.h"
 #include "itype.h"
 #include "map_iterator.h"
+#include "lightmap.h"
+#include "game_constants.h"
+#include "turn_arena.h"
 
 #include <chrono>
 #include <algorithm>
+#include <array>
 #include <cmath>
 
 #ifdef SDL_SOUND
@@ -58,6 +62,15 @@ const efftype_id effect_slept_through_alarm( "slept_through_alarm" );
 static const trait_id trait_HEAVYSLEEPER2( "HEAVYSLEEPER2" );
 static const trait_id trait_HEAVYSLEEPER( "HEAVYSLEEPER" );
 
+extern bool trigdist;
+
+/** Cost of sound passing through an opaque tile (wall, closed door) instead of open space */
+static constexpr float SOUND_WALL_ATTENUATION = 10.0f;
+/** Cost of diagonal steps when distances are circular (trigdist option) */
+static constexpr float SOUND_DIAGONAL_COST = 1.41421356f;
+/** Cost of sound passing to an adjacent z-level, the same one the player uses */
+static constexpr int SOUND_ZLEVEL_ATTENUATION = 10;
+
 struct sound_event {
     int volume;
     std::string description;
@@ -84,6 +97,43 @@ static std::vector<std::pair<tripoint, sound_event>> sounds_since_last_turn;
 // The sound events currently displayed to the player.
 static std::unordered_map<tripoint, sound_event> sound_markers;
 
+struct sound_source {
+    tripoint pos;
+    // Volume with weather attenuation applied
+    int volume;
+};
+
+struct sound_tile {
+    // Remaining hearing range: the source volume (twice that for good hearing) minus the cost
+    // of the path from the source, see monster::hear_sound.
+    float range;
+    // Index of the source in sound_field::sources, or -1 if no sound reached the tile
+    int source;
+};
+
+/** Tiles of each z-level, a level stays empty until a sound reaches it. */
+struct sound_levels {
+    std::array<std::vector<sound_tile>, OVERMAP_LAYERS> tiles;
+    // Tiles reached by the last fill, only those are reset for the next one
+    std::array<std::vector<int>, OVERMAP_LAYERS> reached;
+};
+
+/**
+ * Loudest sound reaching each tile of the reality bubble since the last monster turn.
+ * Built by a flood fill from all sounds, so queries don't depend on the number
+ * of sounds and walls muffle noise as it spreads around them.
+ * Good hearing doubles the volume but not the distance, which can change which sound is
+ * the loudest, so there is one fill for each kind of hearing. The good hearing one is
+ * only made once a listener with good hearing asks for it.
+ */
+struct sound_field {
+    std::vector<sound_source> sources;
+    sound_levels normal;
+    sound_levels good;
+    bool good_filled = false;
+};
+static sound_field sound_propagation;
+
 void sounds::ambient_sound( const tripoint &p, int vol, const std::string &description )
 {
     sound( p, vol, description, true );
@@ -108,8 +158,8 @@ void sounds::add_footstep( const tripoint &p, int volume, int, monster * )
         std::make_pair( p, sound_event {volume, "", false, true, "", ""} ) );
 }
 
-template <typename C>
-static void vector_quick_remove( std::vector<C> &source, int index )
+template <typename C, typename A>
+static void vector_quick_remove( std::vector<C, A> &source, int index )
 {
     if( source.size() != 1 ) {
         // Swap the target and the last element of the vector.
@@ -119,13 +169,15 @@ static void vector_quick_remove( std::vector<C> &source, int index )
     source.pop_back();
 }
 
-static std::vector<centroid> cluster_sounds( std::vector<std::pair<tripoint, int>> recent_sounds )
+static turn_vector<centroid> cluster_sounds( const std::vector<std::pair<tripoint, int>> &sounds )
 {
     // If there are too many monsters and too many noise sources (which can be monsters, go figure),
     // applying sound events to monsters can dominate processing time for the whole game,
     // so we cluster sounds and apply the centroids of the sounds to the monster AI
     // to fight the combinatorial explosion.
-    std::vector<centroid> sound_clusters;
+    // Both vectors only live for this turn, so they are taken from the turn arena.
+    turn_vector<std::pair<tripoint, int>> recent_sounds( sounds.begin(), sounds.end() );
+    turn_vector<centroid> sound_clusters;
     const int num_seed_clusters = std::max( std::min( recent_sounds.size(), ( size_t ) 10 ),
                                             ( size_t ) log( recent_sounds.size() ) );
     const size_t stopping_point = recent_sounds.size() - num_seed_clusters;
@@ -198,36 +250,168 @@ int get_signal_for_hordes( const centroid &centr )
     return 0;
 }
 
+// Spreads the sources over the levels, each starting with its volume times volume_factor.
+// Sound passes to the level above or below only where there is no floor between them.
+static void fill_sound_levels( const std::vector<sound_source> &sources, int volume_factor,
+                               sound_levels &levels )
+{
+    const int width = MAPSIZE * SEEX;
+    const int height = MAPSIZE * SEEY;
+
+    for( int z = 0; z < OVERMAP_LAYERS; z++ ) {
+        for( const int index : levels.reached[z] ) {
+            levels.tiles[z][index] = { 0.0f, -1 };
+        }
+        levels.reached[z].clear();
+    }
+
+    // Bucket queue on the remaining range. Every step costs at least 1, so a step never
+    // lands in the bucket being worked on and a tile is final once its bucket comes up.
+    int loudest = 0;
+    for( const sound_source &e : sources ) {
+        loudest = std::max( loudest, volume_factor * e.volume );
+    }
+    std::vector<std::vector<tripoint>> buckets( loudest + 1 );
+
+    const auto reach = [&]( const tripoint &p, float range, int source ) {
+        auto &level = levels.tiles[p.z + OVERMAP_DEPTH];
+        if( level.empty() ) {
+            level.assign( width * height, sound_tile{ 0.0f, -1 } );
+        }
+        const int index = p.x * height + p.y;
+        sound_tile &tile = level[index];
+        if( range <= tile.range ) {
+            return;
+        }
+        if( tile.source < 0 ) {
+            levels.reached[p.z + OVERMAP_DEPTH].push_back( index );
+        }
+        tile = { range, source };
+        buckets[static_cast<int>( range )].push_back( p );
+    };
+
+    for( size_t source = 0; source < sources.size(); source++ ) {
+        reach( sources[source].pos, volume_factor * sources[source].volume, source );
+    }
+
+    const bool zlevels = g->m.has_zlevels();
+    for( int bucket = loudest; bucket >= 0; bucket-- ) {
+        for( const tripoint &p : buckets[bucket] ) {
+            const sound_tile from = levels.tiles[p.z + OVERMAP_DEPTH][p.x * height + p.y];
+            if( static_cast<int>( from.range ) != bucket ) {
+                continue; // reached by a louder sound since
+            }
+
+            const level_cache &cache = g->m.get_cache_ref( p.z );
+            for( int dx = -1; dx <= 1; dx++ ) {
+                for( int dy = -1; dy <= 1; dy++ ) {
+                    const int x = p.x + dx;
+                    const int y = p.y + dy;
+                    if( ( dx == 0 && dy == 0 ) || x < 0 || y < 0 || x >= width || y >= height ) {
+                        continue;
+                    }
+                    float cost = ( trigdist && dx != 0 && dy != 0 ) ? SOUND_DIAGONAL_COST : 1.0f;
+                    if( cache.transparency_cache[x][y] <= LIGHT_TRANSPARENCY_SOLID ) {
+                        cost *= SOUND_WALL_ATTENUATION;
+                    }
+                    const float range = from.range - cost;
+                    if( range > 0 ) {
+                        reach( tripoint( x, y, p.z ), range, from.source );
+                    }
+                }
+            }
+
+            const float range = from.range - SOUND_ZLEVEL_ATTENUATION;
+            if( !zlevels || range <= 0 ) {
+                continue;
+            }
+            if( p.z > -OVERMAP_DEPTH && !cache.floor_cache[p.x][p.y] ) {
+                reach( tripoint( p.x, p.y, p.z - 1 ), range, from.source );
+            }
+            if( p.z < OVERMAP_HEIGHT && !g->m.get_cache_ref( p.z + 1 ).floor_cache[p.x][p.y] ) {
+                reach( tripoint( p.x, p.y, p.z + 1 ), range, from.source );
+            }
+        }
+        buckets[bucket].clear();
+    }
+}
+
+static void propagate_sounds( const std::vector<std::pair<tripoint, int>> &sounds, int weather_vol )
+{
+    auto &field = sound_propagation;
+
+    field.sources.clear();
+    for( const auto &e : sounds ) {
+        const int vol = e.second - weather_vol;
+        if( vol > 0 && g->m.inbounds( e.first ) ) {
+            field.sources.push_back( { e.first, vol } );
+        }
+    }
+
+    fill_sound_levels( field.sources, 1, field.normal );
+    field.good_filled = false;
+}
+
+bool sounds::loudest_sound_at( const tripoint &p, bool goodhearing, tripoint &source, int &volume,
+                               int &distance )
+{
+    if( !g->m.inbounds( p ) ) {
+        return false;
+    }
+    auto &field = sound_propagation;
+    if( goodhearing && !field.good_filled ) {
+        fill_sound_levels( field.sources, 2, field.good );
+        field.good_filled = true;
+    }
+    const auto &level = ( goodhearing ? field.good : field.normal ).tiles[p.z + OVERMAP_DEPTH];
+    if( level.empty() ) {
+        return false;
+    }
+    const sound_tile &tile = level[p.x * MAPSIZE * SEEY + p.y];
+    if( tile.source < 0 ) {
+        return false;
+    }
+    const sound_source &src = field.sources[tile.source];
+    source = src.pos;
+    volume = src.volume;
+    distance = std::ceil( ( goodhearing ? 2 : 1 ) * src.volume - tile.range );
+    return true;
+}
+
 void sounds::process_sounds()
 {
-    std::vector<centroid> sound_clusters = cluster_sounds( recent_sounds );
     const int weather_vol = weather_data( g->weather ).sound_attn;
-    for( const auto &this_centroid : sound_clusters ) {
-        // Since monsters don't go deaf ATM we can just use the weather modified volume
-        // If they later get physical effects from loud noises we'll have to change this
-        // to use the unmodified volume for those effects.
-        const int vol = this_centroid.volume - weather_vol;
-        const tripoint source = tripoint( this_centroid.x, this_centroid.y, this_centroid.z );
-        // --- Monster sound handling here ---
-        // Alert all hordes
-        int sig_power = get_signal_for_hordes( this_centroid );
-        if( sig_power > 0 ) {
-
-            const point abs_ms = g->m.getabs( source.x, source.y );
-            const point abs_sm = ms_to_sm_copy( abs_ms );
-            const tripoint target( abs_sm.x, abs_sm.y, source.z );
-            overmap_buffer.signal_hordes( target, sig_power );
-        }
-        // Alert all monsters (that can hear) to the sound.
-        for( monster &critter : g->all_monsters() ) {
-            // @todo: Generalize this to Creature::hear_sound
-            const int dist = rl_dist( source, critter.pos() );
-            if( vol * 2 > dist ) {
-                // Exclude monsters that certainly won't hear the sound
-                critter.hear_sound( source, vol, dist );
+    if( !recent_sounds.empty() ) {
+        const turn_vector<centroid> sound_clusters = cluster_sounds( recent_sounds );
+        for( const auto &this_centroid : sound_clusters ) {
+            // --- Monster sound handling here ---
+            // Alert all hordes
+            int sig_power = get_signal_for_hordes( this_centroid );
+            if( sig_power > 0 ) {
+                const tripoint source = tripoint( this_centroid.x, this_centroid.y, this_centroid.z );
+                const point abs_ms = g->m.getabs( source.x, source.y );
+                const point abs_sm = ms_to_sm_copy( abs_ms );
+                const tripoint target( abs_sm.x, abs_sm.y, source.z );
+                overmap_buffer.signal_hordes( target, sig_power );
             }
         }
     }
+
+    // Since monsters don't go deaf ATM we can just use the weather modified volume
+    // If they later get physical effects from loud noises we'll have to change this
+    // to use the unmodified volume for those effects.
+    propagate_sounds( recent_sounds, weather_vol );
+
+    // Alert all monsters (that can hear) to the loudest sound reaching them.
+    for( monster &critter : g->all_monsters() ) {
+        // @todo: Generalize this to Creature::hear_sound
+        tripoint source;
+        int vol = 0;
+        int dist = 0;
+        if( loudest_sound_at( critter.pos(), critter.has_flag( MF_GOODHEARING ), source, vol, dist ) ) {
+            critter.hear_sound( source, vol, dist );
+        }
+    }
     recent_sounds.clear();
 }
 
@@ -393,6 +577,7 @@ void sounds::process_sound_markers( player *p )
 void sounds::reset_sounds()
 {
     recent_sounds.clear();
+    propagate_sounds( recent_sounds, 0 );
     sounds_since_last_turn.clear();
     sound_markers.clear();
 }
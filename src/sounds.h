@@ -47,6 +47,18 @@ void process_sounds();
 // process_sound_markers applies sound events to the player and records them for display.
 void process_sound_markers( player *p );
 
+/**
+ * Loudest sound that reached a position since the last @ref process_sounds call.
+ * Sound spreads around walls and is muffled when passing through them.
+ * @param goodhearing rank sounds as heard with good hearing (twice the volume, same distance)
+ * @param source position of the sound
+ * @param volume volume of the sound at its source, reduced by weather
+ * @param distance length of the path from the source, increased by walls on the way
+ * @returns false if no sound reached the position.
+ */
+bool loudest_sound_at( const tripoint &p, bool goodhearing, tripoint &source, int &volume,
+                      int &distance );
+
 // Return list of points that have sound events the player can hear.
 std::vector<tripoint> get_footstep_markers();
 // Return list of all sounds and the list of sound cluster centroids.
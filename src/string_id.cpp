@@ -0,0 +1,27 @@
+#include "string_id.h"
+
+#include <unordered_map>
+
+// Constructed on first use as many ids are static objects themselves.
+static std::unordered_map<std::string, std::size_t> &get_interned_ids()
+{
+    static std::unordered_map<std::string, std::size_t> table;
+    return table;
+}
+
+const interned_id &intern_id( const std::string &id )
+{
+    auto &table = get_interned_ids();
+    // Elements of an unordered_map stay where they are on rehashing.
+    const auto iter = table.find( id );
+    if( iter != table.end() ) {
+        return *iter;
+    }
+    return *table.emplace( id, std::hash<std::string>()( id ) ).first;
+}
+
+const interned_id &interned_empty_id()
+{
+    static const interned_id &empty = intern_id( std::string() );
+    return empty;
+}
@@ -2,16 +2,34 @@
 #ifndef STRING_ID_H
 #define STRING_ID_H
 
+#include <cstddef>
 #include <string>
 #include <type_traits>
+#include <utility>
 
 template<typename T>
 class int_id;
 
 /**
- * This represents an identifier (implemented as std::string) of some object.
+ * One entry of the table all id strings are interned in, shared by all string_id types:
+ * the string and its hash. Entries are never removed, so each distinct string is stored
+ * only once and its record can be compared by address.
+ */
+using interned_id = std::pair<const std::string, std::size_t>;
+
+/**
+ * Returns the (stable) record of @p id, adding it to the table if needed.
+ * Not thread-safe, ids are created on the main thread.
+ */
+const interned_id &intern_id( const std::string &id );
+/** Record of the empty string. */
+const interned_id &interned_empty_id();
+
+/**
+ * This represents an identifier (a string, interned with @ref intern_id) of some object.
  * It can be used for all type of objects, one just needs to specify a type as
  * template parameter T, which separates the different identifier types.
+ * Copying, hashing and equality are as cheap as for a pointer.
  *
  * The constructor is explicit on purpose, you have to write
  * \code
@@ -51,29 +69,31 @@ class string_id
         // a std::string, otherwise a "no matching function to call..." error is generated.
         template<typename S, class = typename
                  std::enable_if< std::is_convertible<S, std::string >::value>::type >
-        explicit string_id( S && id, int cid = -1 ) : _id( std::forward<S>( id ) ), _cid( cid ) {
+        explicit string_id( S && id, int cid = -1 ) :
+            _id( &intern_id( std::forward<S>( id ) ) ), _cid( cid ) {
         }
         /**
          * Default constructor constructs an empty id string.
          * Note that this id class does not enforce empty id strings (or any specific string at all)
          * to be special. Every string (including the empty one) may be a valid id.
          */
-        string_id() : _id(), _cid( -1 ) {}
+        string_id() : _id( &interned_empty_id() ), _cid( -1 ) {}
         /**
          * Comparison, only useful when the id is used in std::map or std::set as key. Compares
-         * the string id as with the strings comparison.
+         * the string id as with the strings comparison, so the order does not depend on when
+         * the ids were interned.
          */
         bool operator<( const This &rhs ) const {
-            return _id < rhs._id;
+            return _id != rhs._id && _id->first < rhs._id->first;
         }
         /**
-         * The usual comparator, compares the string id as usual.
+         * The usual comparator, equal strings are interned to the same record.
          */
         bool operator==( const This &rhs ) const {
             return _id == rhs._id;
         }
         /**
-         * The usual comparator, compares the string id as usual.
+         * The usual comparator, equal strings are interned to the same record.
          */
         bool operator!=( const This &rhs ) const {
             return _id != rhs._id;
@@ -82,7 +102,7 @@ class string_id
          * The unusual comparator, compares the string id to char *
          */
         bool operator==( const char *rhs ) const {
-            return _id == rhs;
+            return _id->first == rhs;
         }
         /**
          * Interface to the plain C-string of the id. This function mimics the std::string
@@ -90,7 +110,7 @@ class string_id
          * to be included in the format string, e.g. debugmsg("invalid id: %s", id.c_str())
          */
         const char *c_str() const {
-            return _id.c_str();
+            return _id->first.c_str();
         }
         /**
          * Returns the identifier as plain std::string. Use with care, the plain string does not
@@ -98,11 +118,15 @@ class string_id
          * the class).
          */
         const std::string &str() const {
-            return _id;
+            return _id->first;
+        }
+        /** Hash of the id string, computed once when it was interned. */
+        std::size_t hash() const {
+            return _id->second;
         }
 
         explicit operator std::string() const {
-            return _id;
+            return _id->first;
         }
 
         // Those are optional, you need to implement them on your own if you want to use them.
@@ -135,7 +159,7 @@ class string_id
          * keep consistency with the rest is_.. functions
          */
         bool is_empty() const {
-            return _id.empty();
+            return _id->first.empty();
         }
         /**
          * Returns a null id whose `string_id<T>::is_null()` must always return true. See @ref is_null.
@@ -189,17 +213,17 @@ class string_id
         }
 
     private:
-        std::string _id;
+        const interned_id *_id;
         mutable int _cid;
 };
 
-// Support hashing of string based ids by forwarding the hash of the string.
+// Support hashing of string based ids by forwarding the (precomputed) hash of the string.
 namespace std
 {
 template<typename T>
 struct hash< string_id<T> > {
     std::size_t operator()( const string_id<T> &v ) const {
-        return hash<std::string>()( v.str() );
+        return v.hash();
     }
 };
 }
@@ -7,6 +7,7 @@
 #include "translations.h"
 #include "path_info.h"
 #include "name.h"
+#include "recipe_dictionary.h"
 
 #include <string>
 #include <set>
@@ -14,11 +15,12 @@
 
 // Names depend on the language settings. They are loaded from different files
 // based on the currently used language. If that changes, we have to reload the
-// names.
-static void reload_names()
+// names and drop the translated recipe texts cached for searching.
+static void reload_translated_data()
 {
     Name::clear();
     Name::load_from_file( PATH_INFO::find_translated_file( "namesdir", ".json", "names" ) );
+    recipe_dictionary::reset_search_index();
 }
 
 #ifdef LOCALIZE
@@ -191,7 +193,7 @@ void set_language()
     bind_textdomain_codeset( "cataclysm-dda", "UTF-8" );
     textdomain( "cataclysm-dda" );
 
-    reload_names();
+    reload_translated_data();
 }
 
 #if (defined MACOSX)
@@ -257,7 +259,7 @@ void select_language()
 
 void set_language()
 {
-    reload_names();
+    reload_translated_data();
     return;
 }
 
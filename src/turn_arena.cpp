@@ -0,0 +1,70 @@
+#include "turn_arena.h"
+
+#include <algorithm>
+
+// The first block, later resets merge all blocks of a turn into one.
+static constexpr size_t initial_block_size = 256 * 1024;
+
+void *turn_arena::allocate( const size_t bytes, const size_t alignment )
+{
+    while( current < blocks.size() ) {
+        block &b = blocks[current];
+        const size_t start = ( offset + alignment - 1 ) / alignment * alignment;
+        if( start + bytes <= b.size ) {
+            offset = start + bytes;
+            return b.data.get() + start;
+        }
+        current++;
+        offset = 0;
+    }
+    const size_t size = std::max( bytes + alignment, blocks.empty() ? initial_block_size :
+                                  blocks.back().size * 2 );
+    blocks.push_back( block{ std::unique_ptr<char[]>( new char[size] ), size } );
+    current = blocks.size() - 1;
+    offset = 0;
+    return allocate( bytes, alignment );
+}
+
+void turn_arena::deallocate( void *const ptr, const size_t bytes )
+{
+    if( current < blocks.size() && static_cast<char *>( ptr ) + bytes == blocks[current].data.get() + offset ) {
+        offset -= bytes;
+    }
+}
+
+void turn_arena::reset()
+{
+    peak_used = std::max( peak_used, used() );
+    if( blocks.size() > 1 ) {
+        // The turn did not fit, so the next one gets a single block that would have.
+        const size_t size = capacity();
+        blocks.clear();
+        blocks.push_back( block{ std::unique_ptr<char[]>( new char[size] ), size } );
+    }
+    current = 0;
+    offset = 0;
+}
+
+size_t turn_arena::used() const
+{
+    size_t result = 0;
+    for( size_t i = 0; i < current && i < blocks.size(); i++ ) {
+        result += blocks[i].size;
+    }
+    return result + offset;
+}
+
+size_t turn_arena::capacity() const
+{
+    size_t result = 0;
+    for( const block &b : blocks ) {
+        result += b.size;
+    }
+    return result;
+}
+
+turn_arena &get_turn_arena()
+{
+    static turn_arena arena;
+    return arena;
+}
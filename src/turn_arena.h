@@ -0,0 +1,87 @@
+#pragma once
+#ifndef TURN_ARENA_H
+#define TURN_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * Bump allocator for short-lived data of one turn.
+ *
+ * Memory is handed out from large blocks and only reclaimed as a whole by @ref reset, which
+ * game::do_turn calls when a new turn starts. Anything allocated here must therefore not
+ * outlive the turn: use it for local containers (see @ref turn_vector), never for members
+ * or for data stored in the map, creatures or items.
+ *
+ * Only the most recent allocation can be handed back early, so the buffers a growing
+ * @ref turn_vector leaves behind stay used until the reset. The same goes for anything
+ * allocated outside of a turn, e.g. while loading or in menus: it piles up until the next
+ * turn starts. The arena then merges its blocks into one that fits all of it.
+ */
+class turn_arena
+{
+    public:
+        void *allocate( size_t bytes, size_t alignment );
+        /** Gives the memory back if it was the last allocation, otherwise does nothing. */
+        void deallocate( void *ptr, size_t bytes );
+        /** Invalidates everything allocated so far. */
+        void reset();
+
+        /** Bytes handed out since the last reset. */
+        size_t used() const;
+        /** Highest @ref used value seen at a reset. */
+        size_t peak() const {
+            return peak_used;
+        }
+        size_t capacity() const;
+
+    private:
+        struct block {
+            std::unique_ptr<char[]> data;
+            size_t size;
+        };
+        std::vector<block> blocks;
+        // Blocks before the current one are full.
+        size_t current = 0;
+        size_t offset = 0;
+        size_t peak_used = 0;
+};
+
+turn_arena &get_turn_arena();
+
+/** Standard allocator handing out memory from the turn arena. */
+template<typename T>
+class turn_allocator
+{
+    public:
+        using value_type = T;
+
+        turn_allocator() = default;
+        template<typename U>
+        turn_allocator( const turn_allocator<U> & ) { }
+
+        T *allocate( size_t n ) {
+            return static_cast<T *>( get_turn_arena().allocate( n * sizeof( T ), alignof( T ) ) );
+        }
+        void deallocate( T *ptr, size_t n ) {
+            get_turn_arena().deallocate( ptr, n * sizeof( T ) );
+        }
+};
+
+template<typename T, typename U>
+bool operator==( const turn_allocator<T> &, const turn_allocator<U> & )
+{
+    return true;
+}
+
+template<typename T, typename U>
+bool operator!=( const turn_allocator<T> &, const turn_allocator<U> & )
+{
+    return false;
+}
+
+template<typename T>
+using turn_vector = std::vector<T, turn_allocator<T>>;
+
+#endif
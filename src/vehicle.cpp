@@ -2080,6 +2080,8 @@ bool vehicle::remove_part( int p )
     if( remove_dependent_part( "WINDOW", "CURTAIN" ) || part_flag( p, VPFLAG_OPAQUE ) ) {
         g->m.set_transparency_cache_dirty( smz );
     }
+    // Obstacles may be gone
+    g->m.set_pathfinding_cache_dirty( smz );
 
     remove_dependent_part( "SEAT", "SEATBELT" );
     remove_dependent_part( "BATTERY_MOUNT", "NEEDS_BATTERY_MOUNT" );
@@ -5915,6 +5917,8 @@ int vehicle::damage_direct( int p, int dmg, damage_type type )
     if( mod_hp( parts[ p ], 0 - dmg, type ) ) {
         insides_dirty = true;
         pivot_dirty = true;
+        // Broken parts are no obstacles
+        g->m.set_pathfinding_cache_dirty( smz );
 
         // destroyed parts lose any contained fuels, battery charges or ammo
         leak_fuel( parts [ p ] );
@@ -6049,6 +6053,7 @@ void vehicle::open_or_close(int const part_index, bool const opening)
     parts[part_index].open = opening ? 1 : 0;
     insides_dirty = true;
     g->m.set_transparency_cache_dirty( smz );
+    g->m.set_pathfinding_cache_dirty( smz );
 
     if (!part_info(part_index).has_flag("MULTISQUARE")) {
         return;
@@ -0,0 +1 @@
+#define VERSION "e0bc946-dirty"
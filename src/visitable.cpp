@@ -1,4 +1,5 @@
 #include "visitable.h"
+#include "visitable_inline.h"
 
 #include "string_id.h"
 #include "debug.h"
@@ -21,7 +22,7 @@ template <typename T>
 item *visitable<T>::find_parent( const item &it )
 {
     item *res = nullptr;
-    if( visit_items( [&]( item * node, item * parent ) {
+    if( visit_items_inline( [&]( item * node, item * parent ) {
     if( node == &it ) {
             res = parent;
             return VisitResponse::ABORT;
@@ -66,7 +67,7 @@ std::vector<const item *> visitable<T>::parents( const item &it ) const
 template <typename T>
 bool visitable<T>::has_item( const item &it ) const
 {
-    return visit_items( [&it]( const item * node ) {
+    return visit_items_inline( [&it]( const item * node, const item * ) {
         return node == &it ? VisitResponse::ABORT : VisitResponse::NEXT;
     } ) == VisitResponse::ABORT;
 }
@@ -75,7 +76,7 @@ bool visitable<T>::has_item( const item &it ) const
 template <typename T>
 bool visitable<T>::has_item_with( const std::function<bool( const item & )> &filter ) const
 {
-    return visit_items( [&filter]( const item * node ) {
+    return visit_items_inline( [&filter]( const item * node, const item * ) {
         return filter( *node ) ? VisitResponse::ABORT : VisitResponse::NEXT;
     } ) == VisitResponse::ABORT;
 }
@@ -102,7 +103,7 @@ static int has_quality_internal( const T &self, const quality_id &qual, int leve
 {
     int qty = 0;
 
-    self.visit_items( [&qual, level, &limit, &qty]( const item * e ) {
+    self.visit_items_inline( [&qual, level, &limit, &qty]( const item * e, const item * ) {
         if( e->get_quality( qual ) >= level ) {
             qty = sum_no_wrap( qty, e->count_by_charges() ? int( e->charges ) : 1 );
             if( qty >= limit ) {
@@ -202,7 +203,7 @@ template <typename T>
 static int max_quality_internal( const T &self, const quality_id &qual )
 {
     int res = INT_MIN;
-    self.visit_items( [&res, &qual]( const item * e ) {
+    self.visit_items_inline( [&res, &qual]( const item * e, const item * ) {
         res = std::max( res, e->get_quality( qual ) );
         return VisitResponse::NEXT;
     } );
@@ -287,7 +288,7 @@ template <typename T>
 std::vector<item *> visitable<T>::items_with( const std::function<bool( const item & )> &filter )
 {
     std::vector<item *> res;
-    visit_items( [&res, &filter]( item * node, item * ) {
+    visit_items_inline( [&res, &filter]( item * node, item * ) {
         if( filter( *node ) ) {
             res.push_back( node );
         }
@@ -302,7 +303,7 @@ std::vector<const item *>
 visitable<T>::items_with( const std::function<bool( const item & )> &filter ) const
 {
     std::vector<const item *> res;
-    visit_items( [&res, &filter]( const item * node, const item * ) {
+    visit_items_inline( [&res, &filter]( const item * node, const item * ) {
         if( filter( *node ) ) {
             res.push_back( node );
         }
@@ -333,149 +334,17 @@ visitable<T>::visit_items( const std::function<VisitResponse( const item * )> &f
 template <typename T>
 VisitResponse visitable<T>::visit_items( const std::function<VisitResponse( item * )> &func )
 {
-    return visit_items( [&func]( item * it, item * ) {
+    return visit_items_inline( [&func]( item * it, item * ) {
         return func( it );
     } );
 }
 
-// Specialize visitable<T>::visit_items() for each class that will implement the visitable interface
-
-static VisitResponse visit_internal( const std::function<VisitResponse( item *, item * )> &func,
-                                     item *node, item *parent = nullptr )
-{
-    switch( func( node, parent ) ) {
-        case VisitResponse::ABORT:
-            return VisitResponse::ABORT;
-
-        case VisitResponse::NEXT:
-            if( node->is_gun() || node->is_magazine() ) {
-                // Content of guns and magazines are accessible only via their specific accessors
-                return VisitResponse::NEXT;
-            }
-
-            for( auto &e : node->contents ) {
-                if( visit_internal( func, &e, node ) == VisitResponse::ABORT ) {
-                    return VisitResponse::ABORT;
-                }
-            }
-        /* intentional fallthrough */
-
-        case VisitResponse::SKIP:
-            return VisitResponse::NEXT;
-    }
-
-    /* never reached but suppresses GCC warning */
-    return VisitResponse::ABORT;
-}
-
-/** @relates visitable */
-template <>
-VisitResponse visitable<item>::visit_items(
-    const std::function<VisitResponse( item *, item * )> &func )
-{
-    auto it = static_cast<item *>( this );
-    return visit_internal( func, it );
-}
-
-/** @relates visitable */
-template <>
-VisitResponse visitable<inventory>::visit_items(
-    const std::function<VisitResponse( item *, item * )> &func )
-{
-    auto inv = static_cast<inventory *>( this );
-    for( auto &stack : inv->items ) {
-        for( auto &it : stack ) {
-            if( visit_internal( func, &it ) == VisitResponse::ABORT ) {
-                return VisitResponse::ABORT;
-            }
-        }
-    }
-    return VisitResponse::NEXT;
-}
-
-/** @relates visitable */
-template <>
-VisitResponse visitable<Character>::visit_items(
-    const std::function<VisitResponse( item *, item * )> &func )
-{
-    auto ch = static_cast<Character *>( this );
-
-    if( !ch->weapon.is_null() &&
-        visit_internal( func, &ch->weapon ) == VisitResponse::ABORT ) {
-        return VisitResponse::ABORT;
-    }
-
-    for( auto &e : ch->worn ) {
-        if( visit_internal( func, &e ) == VisitResponse::ABORT ) {
-            return VisitResponse::ABORT;
-        }
-    }
-
-    return ch->inv.visit_items( func );
-}
-
-/** @relates visitable */
-template <>
-VisitResponse visitable<map_cursor>::visit_items(
-    const std::function<VisitResponse( item *, item * )> &func )
-{
-    auto cur = static_cast<map_cursor *>( this );
-
-    // skip inaccessible items
-    if( g->m.has_flag( "SEALED", *cur ) && !g->m.has_flag( "LIQUIDCONT", *cur ) ) {
-        return VisitResponse::NEXT;
-    }
-
-    for( auto &e : g->m.i_at( *cur ) ) {
-        if( visit_internal( func, &e ) == VisitResponse::ABORT ) {
-            return VisitResponse::ABORT;
-        }
-    }
-    return VisitResponse::NEXT;
-}
-
-/** @relates visitable */
-template <>
-VisitResponse visitable<map_selector>::visit_items(
-    const std::function<VisitResponse( item *, item * )> &func )
-{
-    for( auto &cursor : static_cast<map_selector &>( *this ) ) {
-        if( cursor.visit_items( func ) == VisitResponse::ABORT ) {
-            return VisitResponse::ABORT;
-        }
-    }
-    return VisitResponse::NEXT;
-}
-
 /** @relates visitable */
-template <>
-VisitResponse visitable<vehicle_cursor>::visit_items(
-    const std::function<VisitResponse( item *, item * )> &func )
-{
-    auto self = static_cast<vehicle_cursor *>( this );
-
-    int idx = self->veh.part_with_feature( self->part, "CARGO" );
-    if( idx >= 0 ) {
-        for( auto &e : self->veh.get_items( idx ) ) {
-            if( visit_internal( func, &e ) == VisitResponse::ABORT ) {
-                return VisitResponse::ABORT;
-            }
-        }
-    }
-    return VisitResponse::NEXT;
-}
-
-/** @relates visitable */
-template <>
-VisitResponse visitable<vehicle_selector>::visit_items(
+template <typename T>
+VisitResponse visitable<T>::visit_items(
     const std::function<VisitResponse( item *, item * )> &func )
 {
-    for( auto &cursor : static_cast<vehicle_selector &>( *this ) ) {
-        if( cursor.visit_items( func ) == VisitResponse::ABORT ) {
-            return VisitResponse::ABORT;
-        }
-    }
-    return VisitResponse::NEXT;
+    return visit_items_inline( func );
 }
 
 // Specialize visitable<T>::remove_items_with() for each class that will implement the visitable interface
@@ -496,8 +365,8 @@ item visitable<T>::remove_item( item &it )
     }
 }
 
-static void remove_internal( const std::function<bool( item & )> &filter, item &node, int &count,
-                             std::list<item> &res )
+template <typename F>
+static void remove_internal( const F &filter, item &node, int &count, std::list<item> &res )
 {
     for( auto it = node.contents.begin(); it != node.contents.end(); ) {
         if( filter( *it ) ) {
@@ -751,7 +620,7 @@ static long charges_of_internal( const T &self, const itype_id &id, long limit )
     long qty = 0;
 
     bool found_tool_with_UPS = false;
-    self.visit_items( [&]( const item * e ) {
+    self.visit_items_inline( [&]( const item * e, const item * ) {
         if( e->is_tool() ) {
             if( e->typeId() == id ) {
                 // includes charges from any included magazine.
@@ -847,7 +716,7 @@ template <typename T>
 static int amount_of_internal( const T &self, const itype_id &id, bool pseudo, int limit )
 {
     int qty = 0;
-    self.visit_items( [&qty, &id, &pseudo, &limit]( const item * e ) {
+    self.visit_items_inline( [&qty, &id, &pseudo, &limit]( const item * e, const item * ) {
         if( e->typeId() == id && e->allow_crafting_component() && ( pseudo || !e->has_flag( "PSEUDO" ) ) ) {
             qty = sum_no_wrap( qty, 1 );
         }
@@ -893,7 +762,7 @@ int visitable<Character>::amount_of( const std::string &what, bool pseudo, int l
 
     if( what == "apparatus" && pseudo ) {
         int qty = 0;
-        visit_items( [&qty, &limit]( const item * e ) {
+        visit_items_inline( [&qty, &limit]( const item * e, const item * ) {
             if( e->get_quality( quality_id( "SMOKE_PIPE" ) ) >= 1 ) {
                 qty = sum_no_wrap( qty, 1 );
             }
@@ -43,6 +43,17 @@ class visitable
         VisitResponse visit_items( const std::function<VisitResponse( item * )> &func );
         VisitResponse visit_items( const std::function<VisitResponse( const item * )> &func ) const;
 
+        /**
+         * Same as @ref visit_items but the visitor is a template parameter, so it can be inlined
+         * instead of being called through a std::function for each node. Use it for frequent
+         * queries over many items. The visitor is always given both the node and its parent.
+         * @note definitions are in visitable_inline.h which must be included to use this
+         */
+        template <typename F>
+        VisitResponse visit_items_inline( F &&func );
+        template <typename F>
+        VisitResponse visit_items_inline( F &&func ) const;
+
         /**
          * Determine the immediate parent container (if any) for an item.
          * @param it item to search for which must be contained (at any depth) by this object
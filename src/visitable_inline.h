@@ -0,0 +1,166 @@
+#pragma once
+#ifndef VISITABLE_INLINE_H
+#define VISITABLE_INLINE_H
+
+#include "visitable.h"
+
+#include "character.h"
+#include "game.h"
+#include "inventory.h"
+#include "item.h"
+#include "map.h"
+#include "map_selector.h"
+#include "vehicle.h"
+#include "vehicle_selector.h"
+
+#include <utility>
+
+/** Visits node and any items it contains, see @ref visitable::visit_items */
+template <typename F>
+VisitResponse visit_node( F &func, item *node, item *parent = nullptr )
+{
+    switch( func( node, parent ) ) {
+        case VisitResponse::ABORT:
+            return VisitResponse::ABORT;
+
+        case VisitResponse::NEXT:
+            if( node->is_gun() || node->is_magazine() ) {
+                // Content of guns and magazines are accessible only via their specific accessors
+                return VisitResponse::NEXT;
+            }
+
+            for( auto &e : node->contents ) {
+                if( visit_node( func, &e, node ) == VisitResponse::ABORT ) {
+                    return VisitResponse::ABORT;
+                }
+            }
+        /* intentional fallthrough */
+
+        case VisitResponse::SKIP:
+            return VisitResponse::NEXT;
+    }
+
+    /* never reached but suppresses GCC warning */
+    return VisitResponse::ABORT;
+}
+
+/** @relates visitable */
+template <typename T>
+template <typename F>
+VisitResponse visitable<T>::visit_items_inline( F &&func ) const
+{
+    return const_cast<visitable<T> *>( this )->visit_items_inline( std::forward<F>( func ) );
+}
+
+// Specialize visitable<T>::visit_items_inline() for each class that will implement the visitable interface
+
+/** @relates visitable */
+template <>
+template <typename F>
+VisitResponse visitable<item>::visit_items_inline( F &&func )
+{
+    return visit_node( func, static_cast<item *>( this ) );
+}
+
+/** @relates visitable */
+template <>
+template <typename F>
+VisitResponse visitable<inventory>::visit_items_inline( F &&func )
+{
+    auto inv = static_cast<inventory *>( this );
+    for( auto &stack : inv->items ) {
+        for( auto &it : stack ) {
+            if( visit_node( func, &it ) == VisitResponse::ABORT ) {
+                return VisitResponse::ABORT;
+            }
+        }
+    }
+    return VisitResponse::NEXT;
+}
+
+/** @relates visitable */
+template <>
+template <typename F>
+VisitResponse visitable<Character>::visit_items_inline( F &&func )
+{
+    auto ch = static_cast<Character *>( this );
+
+    if( !ch->weapon.is_null() &&
+        visit_node( func, &ch->weapon ) == VisitResponse::ABORT ) {
+        return VisitResponse::ABORT;
+    }
+
+    for( auto &e : ch->worn ) {
+        if( visit_node( func, &e ) == VisitResponse::ABORT ) {
+            return VisitResponse::ABORT;
+        }
+    }
+
+    return ch->inv.visit_items_inline( func );
+}
+
+/** @relates visitable */
+template <>
+template <typename F>
+VisitResponse visitable<map_cursor>::visit_items_inline( F &&func )
+{
+    auto cur = static_cast<map_cursor *>( this );
+
+    // skip inaccessible items
+    if( g->m.has_flag( "SEALED", *cur ) && !g->m.has_flag( "LIQUIDCONT", *cur ) ) {
+        return VisitResponse::NEXT;
+    }
+
+    for( auto &e : g->m.i_at( *cur ) ) {
+        if( visit_node( func, &e ) == VisitResponse::ABORT ) {
+            return VisitResponse::ABORT;
+        }
+    }
+    return VisitResponse::NEXT;
+}
+
+/** @relates visitable */
+template <>
+template <typename F>
+VisitResponse visitable<map_selector>::visit_items_inline( F &&func )
+{
+    for( auto &cursor : static_cast<map_selector &>( *this ) ) {
+        if( cursor.visit_items_inline( func ) == VisitResponse::ABORT ) {
+            return VisitResponse::ABORT;
+        }
+    }
+    return VisitResponse::NEXT;
+}
+
+/** @relates visitable */
+template <>
+template <typename F>
+VisitResponse visitable<vehicle_cursor>::visit_items_inline( F &&func )
+{
+    auto self = static_cast<vehicle_cursor *>( this );
+
+    int idx = self->veh.part_with_feature( self->part, "CARGO" );
+    if( idx >= 0 ) {
+        for( auto &e : self->veh.get_items( idx ) ) {
+            if( visit_node( func, &e ) == VisitResponse::ABORT ) {
+                return VisitResponse::ABORT;
+            }
+        }
+    }
+    return VisitResponse::NEXT;
+}
+
+/** @relates visitable */
+template <>
+template <typename F>
+VisitResponse visitable<vehicle_selector>::visit_items_inline( F &&func )
+{
+    for( auto &cursor : static_cast<vehicle_selector &>( *this ) ) {
+        if( cursor.visit_items_inline( func ) == VisitResponse::ABORT ) {
+            return VisitResponse::ABORT;
+        }
+    }
+    return VisitResponse::NEXT;
+}
+
+#endif
@@ -72,13 +72,43 @@ void weather_effect::glare()
 
 int get_hourly_rotpoints_at_temp( int temp );
 
+// Items lying together were usually last checked together, so a pile of food asks for
+// the same period at the same (absolute) spot over and over. The result can only change
+// when the turn changes, as it depends on the temperature of the map, or with the weather.
+struct rot_since_memo {
+    time_point start = calendar::before_time_starts;
+    time_point end = calendar::before_time_starts;
+    tripoint location;
+    time_point turn = calendar::before_time_starts;
+    unsigned int seed = 0;
+    bool new_game = false;
+    time_duration rot = 0_turns;
+};
+
+static rot_since_memo &last_rot_since()
+{
+    static rot_since_memo last;
+    return last;
+}
+
+void reset_rot_since_cache()
+{
+    last_rot_since() = rot_since_memo();
+}
+
 time_duration get_rot_since( const time_point &start, const time_point &end,
                              const tripoint &location )
 {
+    rot_since_memo &last = last_rot_since();
+    if( last.turn == calendar::turn && last.start == start && last.end == end &&
+        last.location == location && last.seed == g->get_seed() && last.new_game == g->new_game ) {
+        return last.rot;
+    }
+
     time_duration ret = 0;
     const auto &wgen = g->get_cur_weather_gen();
     for( time_point i = start; i < end; i += 1_hours ) {
-        w_point w = wgen.get_weather( location, i, g->get_seed() );
+        w_point w = wgen.get_weather_cached( location, i, g->get_seed() );
         //Use weather if above ground, use map temp if below
 
         double temperature = ( location.z >= 0 ? w.temperature : g->get_temperature( location ) ) + ( g->new_game ? 0 : g->m.temperature( g->m.getlocal( location ) ) );
@@ -89,6 +119,13 @@ time_duration get_rot_since( const time_point &start, const time_point &end,
 
         ret += std::min( 1_hours, end - i ) / 1_hours * get_hourly_rotpoints_at_temp( temperature ) * 1_turns;
     }
+    last.start = start;
+    last.end = end;
+    last.location = location;
+    last.turn = calendar::turn;
+    last.seed = g->get_seed();
+    last.new_game = g->new_game;
+    last.rot = ret;
     return ret;
 }
 
@@ -126,7 +163,7 @@ weather_sum sum_conditions( const time_point &start, const time_point &end,
     time_duration tick_size = 0;
     weather_sum data;
 
-    const auto wgen = g->get_cur_weather_gen();
+    const auto &wgen = g->get_cur_weather_gen();
     for( time_point t = start; t < end; t += tick_size ) {
         const time_duration diff = end - t;
         if( diff < 10_turns ) {
@@ -137,7 +174,14 @@ weather_sum sum_conditions( const time_point &start, const time_point &end,
             tick_size = 1_minutes;
         }
 
-        const auto wtype = wgen.get_weather_conditions( location, to_turn<int>( t ), g->get_seed() );
+        weather_type wtype;
+        if( tick_size == 1_hours ) {
+            // Hourly ticks don't need more than hourly resolution, share memoised samples.
+            const w_point w = wgen.get_weather_cached( location, t, g->get_seed() );
+            wtype = wgen.get_weather_conditions( w, t );
+        } else {
+            wtype = wgen.get_weather_conditions( location, t, g->get_seed() );
+        }
         proc_weather_sum( wtype, data, t, tick_size );
     }
 
@@ -584,9 +628,10 @@ std::string weather_forecast( point const &abs_sm_pos )
     int last_hour = calendar::turn - ( calendar::turn % HOURS(1) );
     for(int d = 0; d < 6; d++) {
         weather_type forecast = WEATHER_NULL;
-        const auto wgen = g->get_cur_weather_gen();
-        for(calendar i(last_hour + 7200 * d); i < last_hour + 7200 * (d + 1); i += 600) {
-            w_point w = wgen.get_weather( abs_ms_pos, i, g->get_seed() );
+        const auto &wgen = g->get_cur_weather_gen();
+        const auto samples = wgen.get_weather_series( abs_ms_pos, last_hour + 7200 * d, 600_turns,
+                             7200 / 600, g->get_seed() );
+        for( const w_point &w : samples ) {
             forecast = std::max( forecast, wgen.get_weather_conditions( w ) );
             high = std::max(high, w.temperature);
             low = std::min(low, w.temperature);
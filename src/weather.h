@@ -165,6 +165,8 @@ double funnel_charges_per_turn( double surface_area_mm2, double rain_depth_mm_pe
  * The returned value is in time at standard conditions it is `end - start`.
  */
 time_duration get_rot_since( const time_point &start, const time_point &end, const tripoint &pos );
+/** Forgets the last result of @ref get_rot_since, for a new or loaded game. */
+void reset_rot_since_cache();
 
 /**
 * Calculates rot per hour at given temperature. Reference in weather_data.cpp
@@ -4,16 +4,21 @@
 #include "calendar.h"
 #include "simplexnoise.h"
 #include "json.h"
+#include "coordinate_conversions.h"
+#include "game_constants.h"
 
 #include <cmath>
 #include <fstream>
 #include <cstdlib>
+#include <algorithm>
 
 namespace
 {
 // GCC doesn't like M_PI here for some reason
 constexpr double PI  = 3.141592653589793238463;
 constexpr double tau = 2 * PI;
+// Memoised samples are dropped wholesale once the cache grows past this.
+constexpr size_t max_cached_samples = 16384;
 } //namespace
 
 weather_generator::weather_generator() = default;
@@ -21,25 +26,63 @@ weather_generator::weather_generator() = default;
 w_point weather_generator::get_weather( const tripoint &location, const time_point &t,
                                         unsigned seed ) const
 {
-    const double x( location.x /
-                    2000.0 ); // Integer x position / widening factor of the Perlin function.
-    const double y( location.y /
-                    2000.0 ); // Integer y position / widening factor of the Perlin function.
+    //limit the random seed during noise calculation, a large value flattens the noise generator to zero
+    //Windows has a rand limit of 32768, other operating systems can have higher limits
+    // Integer position / widening factor of the Perlin function.
+    return get_weather( location.x / 2000.0, location.y / 2000.0, t, seed % 32768 );
+}
+
+w_point weather_generator::get_weather_cached( const tripoint &location, const time_point &t,
+        unsigned seed ) const
+{
+    const tripoint omt = ms_to_omt_copy( location );
+    const int hour = to_turn<int>( t ) / to_turns<int>( 1_hours );
+    const cache_key key( omt.x, omt.y, hour, seed );
+    const auto iter = cache.find( key );
+    if( iter != cache.end() ) {
+        return iter->second;
+    }
+    if( cache.size() >= max_cached_samples ) {
+        cache.clear();
+    }
+    const tripoint sample( omt.x * SEEX * 2, omt.y * SEEY * 2, location.z );
+    const w_point w = get_weather( sample, time_point::from_turn( hour * to_turns<int>( 1_hours ) ),
+                                   seed );
+    cache.emplace( key, w );
+    return w;
+}
+
+std::vector<w_point> weather_generator::get_weather_series( const tripoint &location,
+        const time_point &start, const time_duration &step, int count, unsigned seed ) const
+{
+    std::vector<w_point> result;
+    result.reserve( std::max( count, 0 ) );
+    const double x = location.x / 2000.0;
+    const double y = location.y / 2000.0;
+    const unsigned modSEED = seed % 32768;
+    time_point t = start;
+    for( int i = 0; i < count; ++i, t += step ) {
+        result.push_back( get_weather( x, y, t, modSEED ) );
+    }
+    return result;
+}
+
+w_point weather_generator::get_weather( const double x, const double y, const time_point &t,
+                                        const unsigned modSEED ) const
+{
     const double z( to_turn<int>( t + calendar::season_length() ) /
                     2000.0 ); // Integer turn / widening factor of the Perlin function.
 
     const double dayFraction = time_past_midnight( t ) / 1_days;
 
-    //limit the random seed during noise calculation, a large value flattens the noise generator to zero
-    //Windows has a rand limit of 32768, other operating systems can have higher limits
-    const unsigned modSEED = seed % 32768;
-
     // Noise factors
-    double T( raw_noise_4d( x, y, z, modSEED ) * 4.0 );
+    // Temperature and acid sample the same point, so the noise is only evaluated once.
+    const double TA( raw_noise_4d( x, y, z, modSEED ) );
+    double T( TA * 4.0 );
     double H( raw_noise_4d( x, y, z / 5, modSEED + 101 ) );
     double H2( raw_noise_4d( x, y, z, modSEED + 151 ) / 4 );
     double P( raw_noise_4d( x, y, z / 3, modSEED + 211 ) * 70 );
-    double A( raw_noise_4d( x, y, z, modSEED ) * 8.0 );
+    double A( TA * 8.0 );
     double W;
 
     const double now( ( time_past_new_year( t ) + calendar::season_length() / 2 ) /
@@ -88,7 +131,12 @@ w_point weather_generator::get_weather( const tripoint &location, const time_poi
 weather_type weather_generator::get_weather_conditions( const tripoint &location,
         const time_point &t, unsigned seed ) const
 {
-    w_point w( get_weather( location, t, seed ) );
+    return get_weather_conditions( get_weather( location, t, seed ), t );
+}
+
+weather_type weather_generator::get_weather_conditions( const w_point &w,
+        const time_point &t ) const
+{
     weather_type wt = get_weather_conditions( w );
     // Make sure we don't say it's sunny at night! =P
     if( wt == WEATHER_SUNNY && calendar( to_turn<int>( t ) ).is_night() ) {
@@ -2,9 +2,16 @@
 #ifndef WEATHER_GEN_H
 #define WEATHER_GEN_H
 
+#include "enums.h"
+
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
 struct point;
 struct tripoint;
 class time_point;
+class time_duration;
 class JsonObject;
 enum weather_type : int;
 
@@ -32,12 +39,33 @@ class weather_generator
          * relative position (relative to the map you called getabs on).
          */
         w_point get_weather( const tripoint &, const time_point &, unsigned ) const;
+        /**
+         * Like @ref get_weather, but the location is snapped to its overmap terrain and the
+         * time to the start of its hour. Results are memoised, so repeated bulk queries (rot,
+         * funnels) for the same tile and hour cost a lookup instead of a noise evaluation.
+         */
+        w_point get_weather_cached( const tripoint &, const time_point &, unsigned seed ) const;
+        /**
+         * Samples @p count points in time at @p location, starting at @p start and advancing
+         * by @p step. Cheaper than calling @ref get_weather in a loop for long time skips.
+         */
+        std::vector<w_point> get_weather_series( const tripoint &location, const time_point &start,
+                const time_duration &step, int count, unsigned seed ) const;
         weather_type get_weather_conditions( const tripoint &, const time_point &, unsigned seed ) const;
+        /** Conditions of @p w at time @p t, it is never sunny at night. */
+        weather_type get_weather_conditions( const w_point &w, const time_point &t ) const;
         weather_type get_weather_conditions( const w_point & ) const;
         int get_water_temperature() const;
         void test_weather() const;
 
         static weather_generator load( JsonObject &jo );
+
+    private:
+        w_point get_weather( double x, double y, const time_point &t, unsigned modSEED ) const;
+
+        /** Keyed by overmap terrain x, y, hour and seed. */
+        using cache_key = std::tuple<int, int, int, unsigned>;
+        mutable std::unordered_map<cache_key, w_point> cache;
 };
 
 #endif
@@ -420,7 +420,7 @@ void cata_cursesport::curses_drawwindow( const catacurses::window &w )
                 int FG = cell.FG;
                 int BG = cell.BG;
                 FillRectDIB(drawx,drawy,fontwidth,fontheight,BG);
-                static const std::string space_string = " ";
+                static const char *const space_string = " ";
                 // Spaces don't need any drawing except background
                 if( cell.ch == space_string ) {
                     continue;
@@ -441,7 +441,7 @@ void cata_cursesport::curses_drawwindow( const catacurses::window &w )
                         i += cw - 1;
                     }
                     if (tmp) {
-                        const std::wstring utf16 = widen(cell.ch);
+                        const std::wstring utf16 = widen(cell.ch.str());
                         ExtTextOutW( backbuffer, drawx, drawy, 0, NULL, utf16.c_str(), utf16.length(), NULL );
                     }
                 } else {
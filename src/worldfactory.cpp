@@ -246,6 +246,8 @@ WORLDPTR worldfactory::convert_to_world(const std::string &origin_path)
 void worldfactory::set_active_world(WORLDPTR world)
 {
     world_generator->active_world = world;
+    // World options now come from a different set.
+    options_manager::mark_values_changed();
 }
 
 bool worldfactory::save_world(WORLDPTR world, bool is_conversion)
@@ -576,6 +578,7 @@ void worldfactory::remove_world(const std::string &worldname)
         WORLDPTR wptr = it->second;
         if( active_world == wptr ) {
             active_world = nullptr;
+            options_manager::mark_values_changed();
         }
         delete wptr;
         all_worlds.erase( it );
@@ -1388,6 +1391,7 @@ void WORLD::load_legacy_options( std::istream &fin )
 bool worldfactory::load_world_options(WORLDPTR &world)
 {
     world->WORLD_OPTIONS = get_options().get_world_defaults();
+    options_manager::mark_values_changed();
 
     using namespace std::placeholders;
     const auto path = world->folder_path() + "/" + FILENAMES["worldoptions"];
@@ -2,6 +2,7 @@
 
 #include "crafting.h"
 #include "game.h"
+#include "inventory.h"
 #include "itype.h"
 #include "npc.h"
 #include "player.h"
@@ -94,6 +95,64 @@ TEST_CASE( "recipe_subset" )
     }
 }
 
+TEST_CASE( "recipe_subset_search" )
+{
+    recipe_subset subset;
+    const recipe *r = &recipe_id( "brew_rum" ).obj();
+    subset.include( r );
+
+    CHECK( subset.search( r->result_name() ).size() == 1 );
+    CHECK( subset.search( "water", recipe_subset::search_type::component ).size() == 1 );
+    CHECK( subset.search( "WaTeR", recipe_subset::search_type::component ).size() == 1 );
+}
+
+TEST_CASE( "recipe_availability" )
+{
+    const recipe *r = &recipe_id( "water_clean" ).obj();
+    const player dummy;
+    recipe_availability availability;
+
+    inventory inv;
+    inv += item( "hotplate", -1, 20 );
+    item plastic_bottle( "bottle_plastic" );
+    plastic_bottle.contents.emplace_back( "water", -1, 2 );
+    inv += plastic_bottle;
+
+    availability.update( dummy, inv );
+    REQUIRE_FALSE( availability.can_make( r ) );
+
+    GIVEN( "an empty pot is added" ) {
+        inventory with_pot( inv );
+        with_pot += item( "pot" );
+        availability.update( dummy, with_pot );
+
+        THEN( "the recipe becomes available" ) {
+            CHECK( availability.can_make( r ) );
+        }
+        AND_WHEN( "the pot gets filled" ) {
+            inventory with_full_pot( inv );
+            item pot( "pot" );
+            pot.contents.emplace_back( "water", -1, 2 );
+            with_full_pot += pot;
+            availability.update( dummy, with_full_pot );
+
+            THEN( "the recipe is no longer available" ) {
+                CHECK_FALSE( availability.can_make( r ) );
+            }
+        }
+        AND_WHEN( "the hotplate is gone" ) {
+            inventory without_hotplate;
+            without_hotplate += plastic_bottle;
+            without_hotplate += item( "pot" );
+            availability.update( dummy, without_hotplate );
+
+            THEN( "the recipe is no longer available" ) {
+                CHECK_FALSE( availability.can_make( r ) );
+            }
+        }
+    }
+}
+
 // This crashes subsequent testcases for some reason.
 TEST_CASE( "available_recipes", "[.]" )
 {
@@ -1,6 +1,8 @@
 #include "catch/catch.hpp"
 
+#include "bodypart.h"
 #include "creature.h"
+#include "effect.h"
 #include "monster.h"
 #include "mtype.h"
 
@@ -73,3 +75,51 @@ TEST_CASE( "Check distribution of attacks to body parts for larger attacker." )
     calculate_bodypart_distribution( MS_MEDIUM, MS_SMALL, 1, expected_weights_base[2] );
     calculate_bodypart_distribution( MS_MEDIUM, MS_SMALL, 100, expected_weights_max[2] );
 }
+
+TEST_CASE( "targeted_effects_decay_and_expire_per_body_part" )
+{
+    const efftype_id effect_bleed( "bleed" );
+    const efftype_id effect_downed( "downed" );
+    monster zed( mtype_id( "mon_zombie" ) );
+
+    // monster::add_effect drops the body part, targeted effects need the base version.
+    zed.Creature::add_effect( effect_bleed, 3_turns, bp_leg_r, false, 0, true, true );
+    zed.Creature::add_effect( effect_bleed, 1_turns, bp_arm_l, false, 0, true, true );
+    zed.Creature::add_effect( effect_downed, 2_turns, num_bp, false, 0, true, true );
+    REQUIRE( zed.has_effect( effect_bleed ) );
+    REQUIRE( zed.has_effect( effect_bleed, bp_arm_l ) );
+    REQUIRE( zed.has_effect( effect_bleed, bp_leg_r ) );
+    REQUIRE( !zed.has_effect( effect_bleed, bp_torso ) );
+
+    zed.Creature::process_effects();
+    CHECK( !zed.has_effect( effect_bleed, bp_arm_l ) );
+    CHECK( zed.get_effect_dur( effect_bleed, bp_leg_r ) == 2_turns );
+    CHECK( zed.get_effect_dur( effect_downed ) == 1_turns );
+
+    zed.Creature::process_effects();
+    CHECK( zed.has_effect( effect_bleed, bp_leg_r ) );
+    CHECK( !zed.has_effect( effect_downed ) );
+
+    zed.Creature::process_effects();
+    CHECK( !zed.has_effect( effect_bleed ) );
+}
+
+TEST_CASE( "effect_references_survive_adding_other_body_parts" )
+{
+    const efftype_id effect_bleed( "bleed" );
+    monster zed( mtype_id( "mon_zombie" ) );
+
+    zed.Creature::add_effect( effect_bleed, 5_turns, bp_leg_r, false, 0, true, true );
+    effect &leg = zed.get_effect( effect_bleed, bp_leg_r );
+    // These go before and after the leg, for every body part that could move it.
+    // Bleeding is on main parts only, the right foot would add to the leg.
+    for( int bp = 0; bp < num_bp; bp++ ) {
+        if( mutate_to_main_part( static_cast<body_part>( bp ) ) != bp_leg_r ) {
+            zed.Creature::add_effect( effect_bleed, 1_turns, static_cast<body_part>( bp ), false, 0,
+                                      true, true );
+        }
+    }
+    CHECK( &leg == &zed.get_effect( effect_bleed, bp_leg_r ) );
+    CHECK( leg.get_bp() == bp_leg_r );
+    CHECK( leg.get_duration() == 5_turns );
+}
@@ -6,11 +6,15 @@
 #include "itype.h"
 #include "line.h"
 #include "map.h"
+#include "mapdata.h"
 #include "monster.h"
 
 #include "map_helpers.h"
 #include "test_statistics.h"
 
+#include <chrono>
+#include <cstdio>
+
 void check_lethality( std::string explosive_id, int range, float lethality )
 {
     int num_survivors = 0;
@@ -74,3 +78,42 @@ TEST_CASE( "grenade_lethal_at_5m", "[grenade],[explosion],[balance]" )
     check_lethality( "grenade_act", 5, 0.95 );
     check_lethality( "grenade_act", 15, 0.5 );
 }
+
+TEST_CASE( "blast_from_off_the_map_reaches_it", "[explosion]" )
+{
+    clear_map();
+    const tripoint next_to_edge( 0, 30, 0 );
+    monster &zed = spawn_test_monster( "mon_zombie", next_to_edge );
+    const int hp = zed.get_hp();
+    g->explosion( next_to_edge + tripoint( -1, 0, 0 ), 300.0f, 0.8f, false );
+    CHECK( ( zed.is_dead() || zed.get_hp() < hp ) );
+    clear_map();
+}
+
+// Times game::explosion over a walled-in block, run with tests/cata_test "[benchmark]"
+TEST_CASE( "explosion_benchmark", "[.][benchmark]" )
+{
+    const int explosions = 50;
+    const std::vector<std::pair<const char *, float>> sizes = {
+        { "small", 100.0f }, { "medium", 1000.0f }, { "large", 5000.0f }
+    };
+    for( const auto &size : sizes ) {
+        double total_ms = 0.0;
+        for( int i = 0; i < explosions; i++ ) {
+            clear_map();
+            for( int x = 20; x < 100; x++ ) {
+                for( int y = 20; y < 100; y++ ) {
+                    if( x % 8 == 0 || y % 8 == 0 ) {
+                        g->m.ter_set( tripoint( x, y, 0 ), t_wall );
+                    }
+                }
+            }
+            const auto start = std::chrono::steady_clock::now();
+            g->explosion( tripoint( 60, 60, 0 ), size.second, 0.8f, false );
+            const std::chrono::duration<double, std::milli> spent = std::chrono::steady_clock::now() - start;
+            total_ms += spent.count();
+        }
+        printf( "%s: %.3f ms/explosion\n", size.first, total_ms / explosions );
+    }
+    clear_map();
+}
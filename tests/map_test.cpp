@@ -1,7 +1,9 @@
 #include "catch/catch.hpp"
 
+#include "field.h"
 #include "game.h"
 #include "map.h"
+#include "map_iterator.h"
 #include "player.h"
 
 #include "map_helpers.h"
@@ -25,3 +27,58 @@ TEST_CASE( "destroy_grabbed_furniture" )
         }
     }
 }
+
+TEST_CASE( "sees_follows_transparency_changes" )
+{
+    clear_map();
+    const tripoint from( 60, 60, 0 );
+    const tripoint to( 66, 62, 0 );
+    g->u.setpos( from );
+    g->m.build_map_cache( 0, true );
+    REQUIRE( g->m.sees( from, to, 10 ) );
+    // Answered from the cache the second time
+    CHECK( g->m.sees( from, to, 10 ) );
+    CHECK_FALSE( g->m.sees( from, to, 5 ) );
+
+    for( int y = 57; y <= 65; y++ ) {
+        g->m.ter_set( tripoint( 63, y, 0 ), ter_id( "t_wall" ) );
+    }
+    g->m.build_map_cache( 0, true );
+    CHECK_FALSE( g->m.sees( from, to, 10 ) );
+}
+
+TEST_CASE( "radiant_heat_needs_line_of_sight" )
+{
+    clear_map();
+    const tripoint spot( 60, 60, 0 );
+    g->u.setpos( spot );
+    g->m.build_map_cache( 0, true );
+    CHECK( g->m.radiant_heat_at( spot ).sources.empty() );
+
+    g->m.add_field( tripoint( 63, 60, 0 ), fd_fire, 2 );
+    g->m.add_field( tripoint( 61, 61, 0 ), fd_fire, 1 );
+    const radiant_heat &heat = g->m.radiant_heat_at( spot );
+    CHECK( heat.sources.size() == 2 );
+    CHECK( heat.adjacent == 1 );
+
+    g->m.ter_set( tripoint( 62, 60, 0 ), ter_id( "t_wall" ) );
+    g->m.build_map_cache( 0, true );
+    CHECK( g->m.radiant_heat_at( spot ).sources.size() == 1 );
+}
+
+TEST_CASE( "radiant_heat_counts_lava_once" )
+{
+    clear_map();
+    const tripoint spot( 60, 60, 0 );
+    // clear_map leaves fields alone
+    for( const tripoint &p : g->m.points_in_radius( spot, 6 ) ) {
+        g->m.remove_field( p, fd_fire );
+    }
+    g->u.setpos( spot );
+    g->m.ter_set( tripoint( 62, 60, 0 ), ter_id( "t_lava" ) );
+    g->m.build_map_cache( 0, true );
+    const radiant_heat &heat = g->m.radiant_heat_at( spot );
+    REQUIRE( heat.sources.size() == 1 );
+    CHECK( heat.sources[0] == std::make_pair( 3, 2 ) );
+    CHECK( heat.adjacent == 0 );
+}
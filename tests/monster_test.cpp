@@ -5,6 +5,7 @@
 #include "game.h"
 #include "map.h"
 #include "mapdata.h"
+#include "monfaction.h"
 #include "monster.h"
 #include "mtype.h"
 #include "options.h"
@@ -330,3 +331,56 @@ TEST_CASE( "monster_speed_trig", "[speed]" )
     trigdist = true;
     monster_check();
 }
+
+TEST_CASE( "moved_monsters_are_found_at_their_new_position" )
+{
+    clear_map();
+    monster &first = spawn_test_monster( "mon_zombie", tripoint( 30, 30, 0 ) );
+    monster &second = spawn_test_monster( "mon_zombie", tripoint( 40, 30, 0 ) );
+
+    first.setpos( tripoint( 31, 30, 0 ) );
+    second.setpos( tripoint( 30, 30, 0 ) );
+    CHECK( g->critter_at<monster>( tripoint( 31, 30, 0 ) ) == &first );
+    CHECK( g->critter_at<monster>( tripoint( 30, 30, 0 ) ) == &second );
+    CHECK( g->critter_at<monster>( tripoint( 40, 30, 0 ) ) == nullptr );
+    clear_map();
+}
+
+TEST_CASE( "monsters_beyond_sight_range_are_not_targeted" )
+{
+    clear_map();
+    g->u.setpos( tripoint( 5, 5, 0 ) );
+    const tripoint origin( 30, 60, 0 );
+    monster &pet = spawn_test_monster( "mon_zombie", origin );
+    pet.friendly = -1;
+    const int max_sight = std::max( pet.sight_range( DAYLIGHT_LEVEL ), pet.sight_range( 0 ) );
+    const tripoint far_away = origin + tripoint( max_sight + 5, 0, 0 );
+    REQUIRE( g->m.inbounds( far_away ) );
+    REQUIRE( rl_dist( g->u.pos(), origin ) > max_sight );
+    // Visited first, so it would be picked if it were rated like the others.
+    monster &far_zed = spawn_test_monster( "mon_zombie", far_away );
+
+    const auto plan = [&pet]() {
+        mfactions factions;
+        for( monster &critter : g->all_monsters() ) {
+            factions[critter.friendly == 0 ? critter.faction : mfaction_str_id( "player" )].insert(
+                &critter );
+        }
+        pet.unset_dest();
+        pet.plan( factions );
+    };
+
+    plan();
+    CHECK( pet.move_target() == origin );
+
+    const tripoint near( origin + tripoint( 2, 0, 0 ) );
+    spawn_test_monster( "mon_zombie", near );
+    plan();
+    CHECK( pet.move_target() == near );
+
+    // Once in range it is rated again, and wins the tie by being visited first.
+    far_zed.setpos( origin + tripoint( 0, 2, 0 ) );
+    plan();
+    CHECK( pet.move_target() == far_zed.pos() );
+    clear_map();
+}
@@ -0,0 +1,46 @@
+#include "catch/catch.hpp"
+
+#include "options.h"
+
+TEST_CASE( "option_handle_follows_option_changes" )
+{
+    static const option_handle<bool> animations( "ANIMATIONS" );
+    auto &opt = get_options().get_option( "ANIMATIONS" );
+    const std::string original = opt.getValue();
+
+    opt.setValue( "true" );
+    CHECK( animations.get() );
+    opt.setValue( "false" );
+    CHECK_FALSE( animations.get() );
+
+    // The listener stays registered, so it must not refer to locals.
+    static int notified;
+    notified = 0;
+    get_options().add_change_listener( "ANIMATIONS", []() {
+        notified++;
+    } );
+    get_options().notify_listeners();
+    CHECK( notified == 0 );
+    opt.setValue( "true" );
+    get_options().notify_listeners();
+    CHECK( notified == 1 );
+
+    opt.setValue( original );
+}
+
+TEST_CASE( "option_reads_are_counted_per_turn" )
+{
+    static const option_handle<bool> animations( "ANIMATIONS" );
+    options_manager::next_turn();
+    get_option<bool>( "ANIMATIONS" );
+    get_option<bool>( "ANIMATIONS" );
+    animations.get();
+    options_manager::next_turn();
+
+    const std::map<std::string, unsigned int> reads = get_options().reads_last_turn();
+    REQUIRE( reads.count( "ANIMATIONS" ) == 1 );
+    CHECK( reads.at( "ANIMATIONS" ) == 3 );
+
+    options_manager::next_turn();
+    CHECK( get_options().reads_last_turn().count( "ANIMATIONS" ) == 0 );
+}
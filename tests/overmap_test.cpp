@@ -45,3 +45,38 @@ TEST_CASE( "default_overmap_generation_always_succeeds" )
         }
     }
 }
+
+TEST_CASE( "mongroup_store_moves_and_erases_in_place" )
+{
+    mongroup_store store;
+    const mongroup_id group( "GROUP_ZOMBIE" );
+    mongroup horde( group, 10, 10, 0, 1, 5 );
+    horde.horde = true;
+    const mongroup_store::handle h = store.insert( horde );
+    const mongroup_store::handle other = store.insert( mongroup( group, 10, 10, 0, 1, 7 ) );
+    REQUIRE( store.size() == 2 );
+    REQUIRE( store.hordes().size() == 1 );
+
+    mongroup *before = &store.get( h );
+    store.move( h, tripoint( 11, 10, 0 ) );
+    // The group is not copied by the move, only the index is updated.
+    CHECK( &store.get( h ) == before );
+    CHECK( store.get( h ).pos == tripoint( 11, 10, 0 ) );
+
+    int at_old = 0;
+    store.for_each_at( tripoint( 10, 10, 0 ), [&]( const mongroup & ) {
+        at_old++;
+    } );
+    int at_new = 0;
+    store.for_each_at( tripoint( 11, 10, 0 ), [&]( const mongroup & mg ) {
+        at_new++;
+        CHECK( mg.population == 5 );
+    } );
+    CHECK( at_old == 1 );
+    CHECK( at_new == 1 );
+
+    store.erase( h );
+    CHECK( store.size() == 1 );
+    CHECK( store.hordes().empty() );
+    CHECK( store.get( other ).population == 7 );
+}
@@ -14,6 +14,7 @@
 #include "itype.h"
 
 #include <string>
+#include <list>
 
 // Set the stage for a particular ambient and target temperature and run update_bodytemp() until
 // core body temperature settles.
@@ -133,3 +134,42 @@ TEST_CASE( "Player body temperatures converge on expected values.", "[.bodytemp]
         test_temperature_spread( &dummy, {{ -115, -87, -54, -6, 36, 64, 80 }} );
     }
 }
+
+TEST_CASE( "worn_summary_follows_worn_items" )
+{
+    player dummy;
+    dummy.worn.clear();
+    CHECK_FALSE( dummy.is_wearing_helmet() );
+    CHECK_FALSE( dummy.is_wearing_shoes( side::BOTH ) );
+    CHECK( dummy.warmth( bp_torso ) == 0 );
+
+    equip_clothing( &dummy, "hat_hard" );
+    equip_clothing( &dummy, "boots" );
+    equip_clothing( &dummy, "sweater" );
+    CHECK( dummy.is_wearing_helmet() );
+    CHECK( dummy.is_wearing_shoes( side::BOTH ) );
+    CHECK( dummy.wearing_something_on( bp_arm_l ) );
+    CHECK( dummy.worn_with_flag( "WATERPROOF", bp_head ) );
+    CHECK_FALSE( dummy.worn_with_flag( "WATERPROOF", bp_torso ) );
+    // Wool keeps its warmth when wet
+    const int dry_warmth = dummy.warmth( bp_torso );
+    CHECK( dry_warmth > 0 );
+    dummy.body_wetness[bp_torso] = dummy.drench_capacity[bp_torso];
+    CHECK( dummy.warmth( bp_torso ) == dry_warmth );
+
+    // Taking it off into a list, the dummy has no room in its inventory.
+    std::list<item> taken_off;
+    REQUIRE( dummy.takeoff( dummy.worn.front(), &taken_off ) );
+    CHECK_FALSE( dummy.is_wearing_helmet() );
+    CHECK_FALSE( dummy.worn_with_flag( "WATERPROOF", bp_head ) );
+    CHECK( dummy.is_wearing_shoes( side::LEFT ) );
+
+    // Switched on while worn, without taking it off
+    dummy.worn.clear();
+    equip_clothing( &dummy, "thermal_suit" );
+    const int off_warmth = dummy.warmth( bp_torso );
+    item &suit = dummy.worn.front();
+    suit.type->invoke( dummy, suit, dummy.pos() );
+    REQUIRE( suit.typeId() == "thermal_suit_on" );
+    CHECK( dummy.warmth( bp_torso ) > off_warmth );
+}
@@ -0,0 +1,66 @@
+#include "catch/catch.hpp"
+
+#include "profiler.h"
+
+#include <cstring>
+
+// Zones are compiled out with CATA_NO_PROFILER, there is nothing to test then.
+#ifndef CATA_NO_PROFILER
+
+static void profiled_inner()
+{
+    CATA_PROFILE_ZONE( "test_inner" );
+}
+
+static void profiled_outer()
+{
+    CATA_PROFILE_ZONE( "test_outer" );
+    for( int i = 0; i < 3; i++ ) {
+        profiled_inner();
+    }
+}
+
+static const profiler::zone_stats *find_zone( const char *name )
+{
+    for( const profiler::zone_stats &zone : profiler::last_turn() ) {
+        if( std::strcmp( zone.name, name ) == 0 ) {
+            return &zone;
+        }
+    }
+    return nullptr;
+}
+
+TEST_CASE( "profiler_builds_zone_tree_per_turn" )
+{
+    profiler::next_turn();
+
+    SECTION( "nothing is recorded while disabled" ) {
+        profiler::set_enabled( false );
+        profiled_outer();
+        profiler::next_turn();
+        CHECK( find_zone( "test_outer" ) == nullptr );
+    }
+
+    SECTION( "nested zones are counted below their parent" ) {
+        profiler::set_enabled( true );
+        profiled_outer();
+        profiled_outer();
+        profiler::set_enabled( false );
+        profiler::next_turn();
+
+        const profiler::zone_stats *outer = find_zone( "test_outer" );
+        const profiler::zone_stats *inner = find_zone( "test_inner" );
+        REQUIRE( outer != nullptr );
+        REQUIRE( inner != nullptr );
+        CHECK( outer->calls == 2 );
+        CHECK( inner->calls == 6 );
+        CHECK( inner->depth == outer->depth + 1 );
+        CHECK( inner->ms <= outer->ms );
+
+        // The next turn starts empty.
+        profiler::next_turn();
+        CHECK( find_zone( "test_outer" ) == nullptr );
+    }
+}
+
+#endif
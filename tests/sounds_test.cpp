@@ -0,0 +1,83 @@
+#include "catch/catch.hpp"
+
+#include "game.h"
+#include "map.h"
+#include "mapdata.h"
+#include "sounds.h"
+
+#include "map_helpers.h"
+
+TEST_CASE( "sound_propagation" )
+{
+    clear_map();
+    const tripoint origin( 30, 30, 0 );
+
+    GIVEN( "a sound in the open" ) {
+        g->m.build_map_cache( 0, true );
+        sounds::sound( origin, 40, "" );
+        sounds::process_sounds();
+
+        THEN( "it's heard at the straight distance from its source" ) {
+            tripoint source;
+            int vol = 0;
+            int dist = 0;
+            REQUIRE( sounds::loudest_sound_at( origin + tripoint( 5, 0, 0 ), false, source, vol, dist ) );
+            CHECK( source == origin );
+            CHECK( dist == 5 );
+        }
+        THEN( "it's not heard out of its range" ) {
+            tripoint source;
+            int vol = 0;
+            int dist = 0;
+            CHECK_FALSE( sounds::loudest_sound_at( origin + tripoint( 90, 0, 0 ), true, source, vol, dist ) );
+        }
+    }
+
+    GIVEN( "a sound enclosed by walls" ) {
+        for( int x = -3; x <= 3; x++ ) {
+            for( int y = -3; y <= 3; y++ ) {
+                if( std::abs( x ) == 3 || std::abs( y ) == 3 ) {
+                    g->m.ter_set( origin + tripoint( x, y, 0 ), t_wall );
+                }
+            }
+        }
+        g->m.build_map_cache( 0, true );
+        sounds::sound( origin, 40, "" );
+        sounds::process_sounds();
+
+        THEN( "the walls muffle it" ) {
+            tripoint source;
+            int vol = 0;
+            int dist_inside = 0;
+            int dist_outside = 0;
+            REQUIRE( sounds::loudest_sound_at( origin + tripoint( 2, 0, 0 ), false, source, vol, dist_inside ) );
+            REQUIRE( sounds::loudest_sound_at( origin + tripoint( 5, 0, 0 ), false, source, vol, dist_outside ) );
+            CHECK( dist_inside == 2 );
+            CHECK( dist_outside > 5 + 5 );
+        }
+    }
+}
+
+TEST_CASE( "loudest_sound_depends_on_hearing" )
+{
+    clear_map();
+    g->m.build_map_cache( 0, true );
+    const tripoint listener( 65, 60, 0 );
+    const tripoint near( 60, 60, 0 );
+    const tripoint far( 125, 60, 0 );
+    sounds::sound( near, 20, "" );
+    sounds::sound( far, 50, "" );
+    sounds::process_sounds();
+
+    tripoint source;
+    int vol = 0;
+    int dist = 0;
+    // Too far for the loud sound to be heard normally, the quiet one is heard instead.
+    REQUIRE( sounds::loudest_sound_at( listener, false, source, vol, dist ) );
+    CHECK( source == near );
+    CHECK( dist == 5 );
+    // Good hearing doubles the volume, which makes the far sound the louder one.
+    REQUIRE( sounds::loudest_sound_at( listener, true, source, vol, dist ) );
+    CHECK( source == far );
+    CHECK( dist == 60 );
+}
@@ -0,0 +1,32 @@
+#include "catch/catch.hpp"
+
+#include "string_id.h"
+
+#include <functional>
+#include <string>
+
+class string_id_test_type;
+using test_id = string_id<string_id_test_type>;
+
+TEST_CASE( "string_id_interns_equal_strings" )
+{
+    const std::string name = "string_id_test";
+    const test_id from_literal( "string_id_test" );
+    const test_id from_string( name );
+    const test_id other( "string_id_test_other" );
+
+    CHECK( from_literal == from_string );
+    CHECK( &from_literal.str() == &from_string.str() );
+    CHECK( from_literal != other );
+    CHECK( from_literal.str() == name );
+    CHECK( from_literal == "string_id_test" );
+    CHECK( std::hash<test_id>()( from_literal ) == std::hash<std::string>()( name ) );
+
+    // Ordered like the strings, not like the records
+    CHECK( from_literal < other );
+    CHECK_FALSE( other < from_literal );
+    CHECK_FALSE( from_literal < from_string );
+
+    CHECK( test_id().is_empty() );
+    CHECK( test_id() == test_id( "" ) );
+}
@@ -0,0 +1,55 @@
+#include "catch/catch.hpp"
+
+#include "turn_arena.h"
+
+#include <cstdint>
+
+TEST_CASE( "turn_arena_reuses_memory_after_reset" )
+{
+    turn_arena arena;
+
+    void *const first = arena.allocate( 100, 8 );
+    void *const second = arena.allocate( 1, 16 );
+    CHECK( reinterpret_cast<std::uintptr_t>( second ) % 16 == 0 );
+    CHECK( arena.used() >= 101 );
+
+    // Only the most recent allocation can be handed back.
+    arena.deallocate( first, 100 );
+    CHECK( arena.used() >= 101 );
+    arena.deallocate( second, 1 );
+    CHECK( arena.allocate( 1, 16 ) == second );
+
+    arena.reset();
+    CHECK( arena.used() == 0 );
+    CHECK( arena.allocate( 100, 8 ) == first );
+}
+
+TEST_CASE( "turn_arena_merges_blocks_of_a_large_turn" )
+{
+    turn_arena arena;
+    for( int i = 0; i < 10; i++ ) {
+        arena.allocate( 200 * 1024, 8 );
+    }
+    const size_t reserved = arena.capacity();
+    CHECK( reserved >= 2000 * 1024 );
+
+    arena.reset();
+    CHECK( arena.capacity() == reserved );
+    CHECK( arena.peak() >= 2000 * 1024 );
+    // The whole turn fits into the merged block now.
+    for( int i = 0; i < 10; i++ ) {
+        arena.allocate( 200 * 1024, 8 );
+    }
+    CHECK( arena.capacity() == reserved );
+}
+
+TEST_CASE( "turn_vector_uses_the_turn_arena" )
+{
+    const size_t before = get_turn_arena().used();
+    turn_vector<int> numbers;
+    for( int i = 0; i < 1000; i++ ) {
+        numbers.push_back( i );
+    }
+    CHECK( numbers[999] == 999 );
+    CHECK( get_turn_arena().used() >= before + 1000 * sizeof( int ) );
+}
@@ -0,0 +1,213 @@
+#include "catch/catch.hpp"
+
+#include "field.h"
+#include "game.h"
+#include "line.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "mapdata.h"
+#include "monster.h"
+#include "npc.h"
+#include "overmapbuffer.h"
+#include "player.h"
+#include "rng.h"
+#include "sounds.h"
+#include "vehicle.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <vector>
+
+// Headless whole-turn benchmarks. They run game::do_turn on fixed scenarios and print the
+// time spent per turn in each stage of the turn, the untimed rest as "other". Run them with
+// tests/cata_test "[benchmark]"
+
+static const unsigned int benchmark_seed = 4242;
+static const int benchmark_turns = 100;
+
+// Where the player waits out the benchmark, walled in so nothing can reach them.
+static const tripoint bunker_center( 60, 60, 0 );
+
+static void build_bunker()
+{
+    for( int x = -2; x <= 2; x++ ) {
+        for( int y = -2; y <= 2; y++ ) {
+            const tripoint p = bunker_center + tripoint( x, y, 0 );
+            const bool wall = std::abs( x ) == 2 || std::abs( y ) == 2;
+            g->m.set( p, wall ? t_rock : t_floor, f_null );
+        }
+    }
+    g->u.setpos( bunker_center );
+}
+
+static void run_turns( const char *scenario, const std::function<void()> &after_turn )
+{
+    g->m.build_map_cache( 0, true );
+    g->turn_stage_ms.fill( 0.0 );
+    g->time_turn_stages = true;
+
+    const auto start = std::chrono::steady_clock::now();
+    for( int i = 0; i < benchmark_turns; i++ ) {
+        // The player never gets moves, so do_turn does not wait for input.
+        g->u.moves = 0;
+        REQUIRE_FALSE( g->do_turn() );
+        if( after_turn ) {
+            after_turn();
+        }
+    }
+    const std::chrono::duration<double, std::milli> total = std::chrono::steady_clock::now() - start;
+    g->time_turn_stages = false;
+
+    printf( "%s: %d turns, %.3f ms/turn\n", scenario, benchmark_turns, total.count() / benchmark_turns );
+    for( int stage = 0; stage < NUM_TURN_STAGES; stage++ ) {
+        printf( "    %-22s %8.3f ms/turn\n", game::turn_stage_name( static_cast<turn_stage>( stage ) ),
+                g->turn_stage_ms[stage] / benchmark_turns );
+    }
+}
+
+static void horde_siege()
+{
+    for( int i = 0; i < 200; i++ ) {
+        const tripoint p = bunker_center + tripoint( rng( -30, 30 ), rng( -30, 30 ), 0 );
+        if( g->m.passable( p ) && g->critter_at( p ) == nullptr ) {
+            spawn_test_monster( "mon_zombie", p );
+        }
+    }
+    run_turns( "horde siege", nullptr );
+}
+
+static void burning_city()
+{
+    const int mapsize = g->m.getmapsize() * SEEX;
+    for( int x = 0; x < mapsize; x++ ) {
+        for( int y = 0; y < mapsize; y++ ) {
+            const tripoint p( x, y, 0 );
+            if( square_dist( p, bunker_center ) <= 3 ) {
+                continue;
+            }
+            // Blocks of wooden houses with furniture to burn.
+            if( x % 12 == 0 || y % 12 == 0 ) {
+                g->m.set( p, t_pavement, f_null );
+            } else if( x % 12 == 1 || x % 12 == 11 || y % 12 == 1 || y % 12 == 11 ) {
+                g->m.set( p, t_wall_wood, f_null );
+            } else {
+                g->m.set( p, t_floor, one_in( 4 ) ? f_bookcase : f_null );
+            }
+        }
+    }
+    for( int i = 0; i < 100; i++ ) {
+        g->m.add_field( tripoint( rng( 0, mapsize - 1 ), rng( 0, mapsize - 1 ), 0 ), fd_fire, 3 );
+    }
+    run_turns( "burning city", nullptr );
+
+    // clear_map leaves fields alone, the other scenarios must not inherit the fire.
+    for( int x = 0; x < mapsize; x++ ) {
+        for( int y = 0; y < mapsize; y++ ) {
+            const tripoint p( x, y, 0 );
+            while( g->m.field_at( p ).fieldCount() > 0 ) {
+                g->m.remove_field( p, g->m.field_at( p ).begin()->first );
+            }
+        }
+    }
+}
+
+static void noisy_street()
+{
+    for( int i = 0; i < 200; i++ ) {
+        const tripoint p = bunker_center + tripoint( rng( -40, 40 ), rng( -40, 40 ), 0 );
+        if( g->m.passable( p ) && g->critter_at( p ) == nullptr ) {
+            // Some of them hear twice as far
+            spawn_test_monster( one_in( 4 ) ? "mon_cat" : "mon_zombie", p );
+        }
+    }
+    const int mapsize = g->m.getmapsize() * SEEX;
+    // The sounds are processed at the start of the next turn
+    run_turns( "noisy street", [mapsize]() {
+        for( int i = 0; i < 100; i++ ) {
+            sounds::sound( tripoint( rng( 0, mapsize - 1 ), rng( 0, mapsize - 1 ), 0 ), rng( 10, 60 ), "" );
+        }
+    } );
+}
+
+static void npc_base()
+{
+    std::vector<int> ids;
+    for( int i = 0; i < 50; i++ ) {
+        std::shared_ptr<npc> guy = std::make_shared<npc>();
+        guy->normalize();
+        guy->randomize();
+        guy->spawn_at_precise( { g->get_levx(), g->get_levy() },
+                               bunker_center + tripoint( rng( -20, 20 ), rng( 5, 20 ), 0 ) );
+        overmap_buffer.insert_npc( guy );
+        guy->set_attitude( NPCATT_NULL );
+        guy->mission = NPC_MISSION_SHELTER;
+        ids.push_back( guy->getID() );
+    }
+    g->load_npcs();
+    run_turns( "50-NPC base", nullptr );
+
+    g->unload_npcs();
+    for( const int id : ids ) {
+        // Those killed during the benchmark are already gone.
+        if( overmap_buffer.find_npc( id ) != nullptr ) {
+            overmap_buffer.remove_npc( id );
+        }
+    }
+}
+
+static void highway_driving()
+{
+    const int mapsize = g->m.getmapsize() * SEEX;
+    std::vector<vehicle *> cars;
+    for( int lane = 0; lane < 8; lane++ ) {
+        const int y = 20 + lane * 5;
+        for( int x = 0; x < mapsize; x++ ) {
+            for( int dy = -2; dy <= 2; dy++ ) {
+                g->m.set( tripoint( x, y + dy, 0 ), t_pavement, f_null );
+            }
+        }
+        vehicle *car = g->m.add_vehicle( vproto_id( "car" ), tripoint( 30, y, 0 ), 0, 100, 0 );
+        REQUIRE( car != nullptr );
+        car->tags.insert( "IN_CONTROL_OVERRIDE" );
+        car->engine_on = true;
+        car->cruise_velocity = car->safe_velocity();
+        car->velocity = car->cruise_velocity;
+        cars.push_back( car );
+    }
+    std::vector<tripoint> starts;
+    for( const vehicle *car : cars ) {
+        starts.push_back( car->global_pos3() );
+    }
+    // Bring the cars back every turn so they never leave the reality bubble.
+    run_turns( "highway driving", [&]() {
+        for( size_t i = 0; i < cars.size(); i++ ) {
+            tripoint pos = cars[i]->global_pos3();
+            if( vehicle *moved = g->m.displace_vehicle( pos, starts[i] - pos ) ) {
+                cars[i] = moved;
+            }
+        }
+    } );
+}
+
+TEST_CASE( "turn_benchmark", "[.][benchmark]" )
+{
+    const std::vector<std::pair<const char *, void( * )()>> scenarios = {
+        { "horde siege", horde_siege },
+        { "burning city", burning_city },
+        { "noisy street", noisy_street },
+        { "50-NPC base", npc_base },
+        { "highway driving", highway_driving },
+    };
+    for( const auto &scenario : scenarios ) {
+        SECTION( scenario.first ) {
+            srand( benchmark_seed );
+            clear_map();
+            build_bunker();
+            scenario.second();
+            clear_map();
+        }
+    }
+}
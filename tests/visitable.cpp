@@ -3,6 +3,10 @@
 #include "calendar.h"
 #include "inventory.h"
 #include "item.h"
+#include "visitable_inline.h"
+
+#include <chrono>
+#include <cstdio>
 
 
 TEST_CASE( "visitable_summation" )
@@ -20,3 +24,74 @@ TEST_CASE( "visitable_summation" )
 
     CHECK( test_inv.charges_of( "water", item::INFINITE_CHARGES ) > 1 );
 }
+
+TEST_CASE( "visitable_inline_matches_visit_items" )
+{
+    inventory test_inv;
+    for( int i = 0; i < 10; ++i ) {
+        item bottle_of_water( "bottle_plastic", calendar::turn );
+        item water_in_bottle( "water", calendar::turn );
+        water_in_bottle.charges = bottle_of_water.get_remaining_capacity_for_liquid( water_in_bottle );
+        bottle_of_water.put_in( water_in_bottle );
+        test_inv.add_item( bottle_of_water );
+        test_inv.add_item( item( "rock", calendar::turn ) );
+    }
+
+    std::vector<const item *> erased;
+    test_inv.visit_items( [&erased]( const item * e, const item * ) {
+        erased.push_back( e );
+        return VisitResponse::NEXT;
+    } );
+
+    std::vector<const item *> inlined;
+    test_inv.visit_items_inline( [&inlined]( const item * e, const item * ) {
+        inlined.push_back( e );
+        return VisitResponse::NEXT;
+    } );
+
+    CHECK( erased.size() == 30 );
+    CHECK( erased == inlined );
+}
+
+TEST_CASE( "visitable_performance", "[.]" )
+{
+    const int iterations = 1000;
+
+    inventory test_inv;
+    for( int i = 0; i < 500; ++i ) {
+        item bottle_of_water( "bottle_plastic", calendar::turn );
+        item water_in_bottle( "water", calendar::turn );
+        water_in_bottle.charges = bottle_of_water.get_remaining_capacity_for_liquid( water_in_bottle );
+        bottle_of_water.put_in( water_in_bottle );
+        test_inv.add_item( bottle_of_water );
+    }
+
+    long count1 = 0;
+    auto start1 = std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < iterations; i++ ) {
+        test_inv.visit_items( [&count1]( const item * ) {
+            count1++;
+            return VisitResponse::NEXT;
+        } );
+    }
+    auto end1 = std::chrono::high_resolution_clock::now();
+
+    long count2 = 0;
+    auto start2 = std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < iterations; i++ ) {
+        test_inv.visit_items_inline( [&count2]( const item *, const item * ) {
+            count2++;
+            return VisitResponse::NEXT;
+        } );
+    }
+    auto end2 = std::chrono::high_resolution_clock::now();
+
+    CHECK( count1 == count2 );
+
+    long diff1 = std::chrono::duration_cast<std::chrono::nanoseconds>( end1 - start1 ).count();
+    long diff2 = std::chrono::duration_cast<std::chrono::nanoseconds>( end2 - start2 ).count();
+    printf( "visit_items() visited %ld items, %.2f ns per item.\n",
+            count1, double( diff1 ) / count1 );
+    printf( "visit_items_inline() visited %ld items, %.2f ns per item.\n",
+            count2, double( diff2 ) / count2 );
+}
@@ -0,0 +1,38 @@
+#include "catch/catch.hpp"
+
+#include "weather_gen.h"
+#include "calendar.h"
+#include "enums.h"
+#include "game_constants.h"
+
+TEST_CASE( "weather_series_matches_single_samples" )
+{
+    const weather_generator wgen;
+    const tripoint loc( 1234, -567, 0 );
+    const time_point start = time_point::from_turn( 12345 );
+    const auto series = wgen.get_weather_series( loc, start, 10_minutes, 20, 42 );
+    REQUIRE( series.size() == 20 );
+    for( size_t i = 0; i < series.size(); ++i ) {
+        const w_point w = wgen.get_weather( loc, start + 10_minutes * i, 42 );
+        CHECK( series[i].temperature == w.temperature );
+        CHECK( series[i].humidity == w.humidity );
+        CHECK( series[i].pressure == w.pressure );
+        CHECK( series[i].acidic == w.acidic );
+    }
+}
+
+TEST_CASE( "weather_cache_samples_tile_and_hour" )
+{
+    const weather_generator wgen;
+    const tripoint corner( 10 * SEEX * 2, 7 * SEEY * 2, 0 );
+    const time_point hour = time_point::from_turn( 5 * to_turns<int>( 1_hours ) );
+    const w_point expected = wgen.get_weather( corner, hour, 42 );
+
+    // Anywhere on the same overmap terrain within the same hour hits the same sample.
+    const w_point a = wgen.get_weather_cached( corner + tripoint( 3, 5, 0 ), hour + 20_minutes, 42 );
+    const w_point b = wgen.get_weather_cached( corner, hour, 42 );
+    CHECK( a.temperature == expected.temperature );
+    CHECK( a.pressure == expected.pressure );
+    CHECK( b.temperature == expected.temperature );
+    CHECK( b.humidity == expected.humidity );
+}